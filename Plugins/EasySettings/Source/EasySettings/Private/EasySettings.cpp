@@ -1,20 +1,64 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "EasySettings.h"
+#include "EasySettingsRegistry.h"
+#include "EasySettingsStats.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/Package.h"
 
 #define LOCTEXT_NAMESPACE "FEasySettingsModule"
 
+DEFINE_LOG_CATEGORY(LogEasySettings);
+
+DEFINE_STAT(STAT_EasySettings_Setup);
+DEFINE_STAT(STAT_EasySettings_Get);
+DEFINE_STAT(STAT_EasySettings_Update);
+DEFINE_STAT(STAT_EasySettings_ConfigRead);
+DEFINE_STAT(STAT_EasySettings_ConfigWrite);
+DEFINE_STAT(STAT_EasySettings_Flush);
+DEFINE_STAT(STAT_EasySettings_Broadcast);
+DEFINE_STAT(STAT_EasySettings_Flushes);
+DEFINE_STAT(STAT_EasySettings_BytesFlushed);
+DEFINE_STAT(STAT_EasySettings_ListenersNotified);
+DEFINE_STAT(STAT_EasySettings_LookupMisses);
+DEFINE_STAT(STAT_EasySettings_NotificationsCoalesced);
+
+#if EASYSETTINGS_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(EasySettingsChannel);
+TRACE_DECLARE_MEMORY_COUNTER(EasySettings_BytesFlushed, TEXT("EasySettings/BytesFlushed"));
+#endif
+
 void FEasySettingsModule::StartupModule()
 {
-	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
-	
+	// Created here rather than by a GameInstance, so settings can be used by anything that loads after this module.
+	UEasySettingsRegistry* Registry = NewObject<UEasySettingsRegistry>(GetTransientPackage(), TEXT("EasySettingsRegistry"));
+	Registry->AddToRoot();
+	Registry->Initialize();
+
+	PreExitHandle = FCoreDelegates::OnPreExit.AddRaw(this, &FEasySettingsModule::ShutdownRegistry);
 }
 
 void FEasySettingsModule::ShutdownModule()
 {
-	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
-	// we call this function before unloading the module.
-	
+	FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+	ShutdownRegistry();
+}
+
+void FEasySettingsModule::ShutdownRegistry()
+{
+	UEasySettingsRegistry* Registry = UEasySettingsRegistry::TryGet();
+	if (!Registry)
+	{
+		return;
+	}
+
+	Registry->Deinitialize();
+
+	// The object system may already be gone when the module is unloaded at exit.
+	if (UObjectInitialized())
+	{
+		Registry->RemoveFromRoot();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,269 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsBench.h"
+#include "EasySettings.h"
+#include "EasySettingsRegistry.h"
+#include "EasySettingsStatics.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/ConfigCacheIni.h"
+
+namespace EasySettingsBench
+{
+	/** Section every synthetic setting is stored under, emptied once the benchmark is done. */
+	static const TCHAR* BenchSection = TEXT("EasySettingsBench");
+
+	/** Set on the thread being measured for the duration of the measured calls. */
+	static thread_local bool bCountAllocations = false;
+
+	/** Allocations counted on this thread while bCountAllocations was set. */
+	static thread_local uint64 NumAllocations = 0;
+
+	/**
+	 * Forwards to the real allocator while counting the allocations made on the thread being measured.
+	 * Installed into GMalloc on first use and never removed or deleted, other threads may be inside it or have loaded GMalloc at any time.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		/** Installs the allocator into GMalloc the first time it is called. */
+		static FCountingMalloc& Get()
+		{
+			static FCountingMalloc* Instance = [] ()
+			{
+				FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+				GMalloc = CountingMalloc;
+				return CountingMalloc;
+			}();
+			return *Instance;
+		}
+
+		// Begin FMalloc
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("EasySettingsBenchCountingMalloc"); }
+		// End FMalloc
+
+	private:
+		explicit FCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+		{
+		}
+
+		static void CountAllocation()
+		{
+			if (bCountAllocations)
+			{
+				++NumAllocations;
+			}
+		}
+
+		FMalloc* Inner;
+	};
+
+	double FResult::GetPercentile(double Percentile) const
+	{
+		if (Latencies.Num() == 0)
+		{
+			return 0.0;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Latencies.Num()) - 1, 0, Latencies.Num() - 1);
+		return Latencies[Index];
+	}
+
+	double FResult::GetTotal() const
+	{
+		double Total = 0.0;
+		for (double Latency : Latencies)
+		{
+			Total += Latency;
+		}
+		return Total;
+	}
+
+	/**
+	 * Times every call of Operation, with allocations counted and persistence stats diffed across the whole run.
+	 * Pending ini writes are flushed at the end so write-behind costs are attributed to the operation that caused them.
+	 */
+	template <typename OperationType>
+	static FResult Measure(const TCHAR* Name, int32 NumSettings, int32 NumCalls, UEasySettingsRegistry& Registry, OperationType&& Operation)
+	{
+		FResult Result;
+		Result.Operation = Name;
+		Result.NumSettings = NumSettings;
+		Result.Latencies.Reserve(NumCalls);
+
+		const FEasySettingsPersistenceStats StatsBefore = Registry.GetPersistenceStats();
+
+		// Only this thread's allocations are counted, whatever else the engine is doing meanwhile isn't attributed to the operation.
+		FCountingMalloc::Get();
+		NumAllocations = 0;
+		bCountAllocations = true;
+
+		for (int32 Call = 0; Call < NumCalls; ++Call)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Operation(Call);
+			Result.Latencies.Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) * 1000000.0);
+		}
+
+		// Reserve never grows past NumCalls, so recording the latencies isn't counted.
+		bCountAllocations = false;
+		Result.Allocations = NumAllocations;
+
+		Registry.FlushDirtyIniFiles();
+
+		const FEasySettingsPersistenceStats StatsAfter = Registry.GetPersistenceStats();
+		Result.FlushesPerformed = StatsAfter.FlushesPerformed - StatsBefore.FlushesPerformed;
+		Result.FlushedFileBytes = StatsAfter.FlushedFileBytes - StatsBefore.FlushedFileBytes;
+
+		Result.Latencies.Sort();
+		return Result;
+	}
+
+	TArray<FResult> Run(TConstArrayView<int32> SettingCounts)
+	{
+		check(IsInGameThread());
+
+		// The registry is created by the module, so the statics don't need a game instance or world.
+		UEasySettingsRegistry& Registry = UEasySettingsRegistry::Get();
+		const UObject* WorldContext = nullptr;
+
+		const FString IniFileName = GGameUserSettingsIni;
+		TArray<FResult> Results;
+
+		for (const int32 NumSettings : SettingCounts)
+		{
+			// Start every run from an empty section, so Setup always takes the path that writes defaults.
+			GConfig->EmptySection(BenchSection, IniFileName);
+
+			TArray<FFloatSetting> FloatSettings;
+			TArray<FOpposingTogglesSetting> ToggleSettings;
+			FloatSettings.Reserve(NumSettings);
+			ToggleSettings.Reserve(NumSettings);
+			for (int32 Index = 0; Index < NumSettings; ++Index)
+			{
+				FFloatSetting& FloatSetting = FloatSettings.AddDefaulted_GetRef();
+				FloatSetting.IniFile = GameUserSettings;
+				FloatSetting.Section = BenchSection;
+				FloatSetting.Key = FString::Printf(TEXT("Float%d"), Index);
+
+				FOpposingTogglesSetting& ToggleSetting = ToggleSettings.AddDefaulted_GetRef();
+				ToggleSetting.IniFile = GameUserSettings;
+				ToggleSetting.Section = BenchSection;
+				ToggleSetting.Key = FString::Printf(TEXT("Toggle%d"), Index);
+				ToggleSetting.FirstToggle = TEXT("On");
+				ToggleSetting.SecondToggle = TEXT("Off");
+				ToggleSetting.bFirstIsDefault = true;
+			}
+
+			TArray<FSettingHandle> FloatHandles;
+			TArray<FSettingHandle> ToggleHandles;
+			FloatHandles.SetNum(NumSettings);
+			ToggleHandles.SetNum(NumSettings);
+
+			Results.Add(Measure(TEXT("SetupFloat"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				bool bSuccess;
+				UEasySettingsStatics::SetupFloatSettingWithHandle(WorldContext, FloatSettings[Call], bSuccess, FloatHandles[Call]);
+			}));
+
+			Results.Add(Measure(TEXT("SetupToggle"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				bool bSuccess;
+				UEasySettingsStatics::SetupOpposingTogglesSettingWithHandle(WorldContext, ToggleSettings[Call], bSuccess, ToggleHandles[Call]);
+			}));
+
+			// Every toggle is authored with the same names, so this shows roughly what sharing them saves at this setting count.
+			const FEasySettingsMemoryStats MemoryStats = Registry.GetMemoryStats();
+			UE_LOG(LogEasySettings, Display, TEXT("Names of %d settings take %lld bytes, an estimated %lld bytes without sharing. %d option sets."),
+				MemoryStats.NumSettings, MemoryStats.NameBytes, MemoryStats.NameBytesWithoutSharing, MemoryStats.NumOptionSets);
+
+			Results.Add(Measure(TEXT("GetFloatByKey"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				bool bSuccess;
+				FFloatSetting OutSetting;
+				UEasySettingsStatics::GetFloatSetting(WorldContext, FloatSettings[Call], bSuccess, OutSetting);
+			}));
+
+			Results.Add(Measure(TEXT("GetFloatValue"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				bool bSuccess;
+				float OutCurrent;
+				UEasySettingsStatics::GetFloatSettingValue(WorldContext, FloatHandles[Call], bSuccess, OutCurrent);
+			}));
+
+			Results.Add(Measure(TEXT("GetFloatValueNative"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				float OutCurrent;
+				Registry.TryGetFloatValue(FloatHandles[Call], OutCurrent);
+			}));
+
+			Results.Add(Measure(TEXT("GetToggleValue"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				bool bSuccess;
+				bool bFirstIsActive;
+				UEasySettingsStatics::GetOpposingTogglesSettingValue(WorldContext, ToggleHandles[Call], bSuccess, bFirstIsActive);
+			}));
+
+			Results.Add(Measure(TEXT("UpdateFloat"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				bool bSuccess;
+				UEasySettingsStatics::UpdateFloatSettingByHandle(WorldContext, FloatHandles[Call], float(Call % 100), bSuccess);
+			}));
+
+			Results.Add(Measure(TEXT("UpdateToggle"), NumSettings, NumSettings, Registry, [&](int32 Call)
+			{
+				bool bSuccess;
+				UEasySettingsStatics::UpdateOpposingTogglesSettingByHandle(WorldContext, ToggleHandles[Call], false, bSuccess);
+			}));
+
+			for (int32 Index = 0; Index < NumSettings; ++Index)
+			{
+				Registry.ReleaseSetting(FloatHandles[Index]);
+				Registry.ReleaseSetting(ToggleHandles[Index]);
+			}
+		}
+
+		// Don't leave thousands of synthetic keys behind in the user's settings.
+		GConfig->EmptySection(BenchSection, IniFileName);
+		GConfig->Flush(false, IniFileName);
+
+		return Results;
+	}
+
+	FString ToCsv(TConstArrayView<FResult> Results)
+	{
+		FString Csv = TEXT("Operation,Settings,Calls,TotalMs,OpsPerSec,P50Us,P90Us,P99Us,MaxUs,AllocsPerOp,Flushes,FlushedFileBytes\n");
+		for (const FResult& Result : Results)
+		{
+			const int32 NumCalls = Result.Latencies.Num();
+			const double TotalUs = Result.GetTotal();
+			const double OpsPerSec = TotalUs > 0.0 ? NumCalls / (TotalUs / 1000000.0) : 0.0;
+			const double AllocsPerOp = NumCalls > 0 ? double(Result.Allocations) / NumCalls : 0.0;
+
+			Csv += FString::Printf(TEXT("%s,%d,%d,%.3f,%.0f,%.3f,%.3f,%.3f,%.3f,%.2f,%d,%lld\n"),
+				*Result.Operation, Result.NumSettings, NumCalls, TotalUs / 1000.0, OpsPerSec,
+				Result.GetPercentile(0.5), Result.GetPercentile(0.9), Result.GetPercentile(0.99), Result.GetPercentile(1.0),
+				AllocsPerOp, Result.FlushesPerformed, Result.FlushedFileBytes);
+		}
+		return Csv;
+	}
+}
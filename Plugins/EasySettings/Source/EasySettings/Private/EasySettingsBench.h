@@ -0,0 +1,42 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Measures the cost of the EasySettings plugin through the real UEasySettingsStatics and UEasySettingsRegistry code paths.
+ * Shared by the EasySettingsBench commandlet and the EasySettings.Bench automation tests.
+ */
+namespace EasySettingsBench
+{
+	/** Timings and counters for one operation at one setting count. */
+	struct FResult
+	{
+		FString Operation;
+		int32 NumSettings = 0;
+
+		/** Microseconds per call, sorted. */
+		TArray<double> Latencies;
+
+		/** Allocations made by the measuring thread across every call. */
+		uint64 Allocations = 0;
+
+		int32 FlushesPerformed = 0;
+
+		/** Size on disk of the ini files flushed, @see FEasySettingsPersistenceStats::FlushedFileBytes. */
+		int64 FlushedFileBytes = 0;
+
+		double GetPercentile(double Percentile) const;
+		double GetTotal() const;
+	};
+
+	/**
+	 * Registers NumSettings synthetic float and toggle settings for each entry of SettingCounts, then times Setup, Get and Update.
+	 * Must run on the game thread. The synthetic settings are released and their ini section emptied before returning.
+	 */
+	TArray<FResult> Run(TConstArrayView<int32> SettingCounts);
+
+	/** Formats the results as CSV, one row per operation and setting count after a header row. */
+	FString ToCsv(TConstArrayView<FResult> Results);
+}
@@ -0,0 +1,48 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsBenchCommandlet.h"
+#include "EasySettings.h"
+#include "EasySettingsBench.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+UEasySettingsBenchCommandlet::UEasySettingsBenchCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UEasySettingsBenchCommandlet::Main(const FString& Params)
+{
+	TArray<int32> SettingCounts = { 10, 1000, 10000 };
+	FString CountsParam;
+	if (FParse::Value(*Params, TEXT("Counts="), CountsParam, false))
+	{
+		TArray<FString> CountStrings;
+		CountsParam.ParseIntoArray(CountStrings, TEXT(","));
+
+		SettingCounts.Reset();
+		for (const FString& CountString : CountStrings)
+		{
+			SettingCounts.Add(FMath::Max(1, FCString::Atoi(*CountString)));
+		}
+	}
+
+	FString OutputFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasySettingsBench"), TEXT("Results.csv"));
+	FParse::Value(*Params, TEXT("Output="), OutputFile);
+
+	const FString Csv = EasySettingsBench::ToCsv(EasySettingsBench::Run(SettingCounts));
+	UE_LOG(LogEasySettings, Display, TEXT("%s"), *Csv);
+
+	if (!FFileHelper::SaveStringToFile(Csv, *OutputFile))
+	{
+		UE_LOG(LogEasySettings, Error, TEXT("EasySettingsBench failed to write results to %s"), *OutputFile);
+		return 1;
+	}
+
+	UE_LOG(LogEasySettings, Display, TEXT("EasySettingsBench results written to %s"), *OutputFile);
+	return 0;
+}
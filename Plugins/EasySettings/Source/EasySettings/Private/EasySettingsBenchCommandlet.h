@@ -0,0 +1,27 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EasySettingsBenchCommandlet.generated.h"
+
+/**
+ * Measures the cost of the EasySettings plugin through the real UEasySettingsStatics and UEasySettingsRegistry code paths.
+ * Runs EasySettingsBench, which registers synthetic float and toggle settings, then times Setup, Get and Update and counts flushes, the size of the flushed ini files and allocations.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=EasySettingsBench [-Counts=10,1000,10000] [-Output=<File.csv>]
+ * Results are written as CSV, by default to Saved/EasySettingsBench/Results.csv.
+ */
+UCLASS()
+class UEasySettingsBenchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasySettingsBenchCommandlet();
+
+	// Begin UCommandlet
+	virtual int32 Main(const FString& Params) override;
+	// End UCommandlet
+};
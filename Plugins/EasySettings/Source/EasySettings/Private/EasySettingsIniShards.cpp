@@ -0,0 +1,116 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsIniShards.h"
+#include "EasySettings.h"
+#include "Async/Async.h"
+#include "Misc/ConfigCacheIni.h"
+
+namespace EasySettingsIniShards
+{
+	/** GConfig file name of every shard loaded so far. GetIniFileName is called for every setting access, so the load only happens once. */
+	static TMap<FName, FString> LoadedShards;
+
+	/** Callers waiting for each shard being loaded by LoadAsync. Removed once the shard is in LoadedShards. */
+	static TMap<FName, TArray<TPromise<FString>>> LoadingShards;
+
+	/** Hands the shard's GConfig file name to everyone waiting for it. */
+	static void FinishLoading(FName Shard, const FString& IniFileName)
+	{
+		// Promises can't be copied, so move them out before the entry goes away.
+		TArray<TPromise<FString>> Waiting;
+		if (TArray<TPromise<FString>>* Found = LoadingShards.Find(Shard))
+		{
+			Waiting = MoveTemp(*Found);
+			LoadingShards.Remove(Shard);
+		}
+
+		for (TPromise<FString>& Promise : Waiting)
+		{
+			Promise.SetValue(IniFileName);
+		}
+	}
+}
+
+FString FEasySettingsIniShards::GetIniFileName(FName Shard)
+{
+	check(IsInGameThread());
+
+	if (const FString* IniFileName = EasySettingsIniShards::LoadedShards.Find(Shard))
+	{
+		return *IniFileName;
+	}
+
+	const FString BaseIniName = GetBaseIniName(Shard);
+
+	// Same as the engine's own ini files: layered over an optional Default ini, saved under the generated config dir.
+	FString IniFileName;
+	if (!FConfigCacheIni::LoadGlobalIniFile(IniFileName, *BaseIniName, nullptr, false, false))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("Failed to load ini shard %s, it will be created on the first flush."), *BaseIniName);
+	}
+
+	EasySettingsIniShards::LoadedShards.Add(Shard, IniFileName);
+	return IniFileName;
+}
+
+FString FEasySettingsIniShards::GetBaseIniName(FName Shard)
+{
+	return Shard.IsNone() ? FString(TEXT("EasySettings")) : FString::Printf(TEXT("EasySettings_%s"), *Shard.ToString());
+}
+
+bool FEasySettingsIniShards::IsLoaded(FName Shard)
+{
+	check(IsInGameThread());
+
+	return EasySettingsIniShards::LoadedShards.Contains(Shard);
+}
+
+TFuture<FString> FEasySettingsIniShards::LoadAsync(FName Shard)
+{
+	check(IsInGameThread());
+
+	if (const FString* IniFileName = EasySettingsIniShards::LoadedShards.Find(Shard))
+	{
+		return MakeFulfilledPromise<FString>(*IniFileName).GetFuture();
+	}
+
+	if (TArray<TPromise<FString>>* Waiting = EasySettingsIniShards::LoadingShards.Find(Shard))
+	{
+		return Waiting->AddDefaulted_GetRef().GetFuture();
+	}
+
+	TFuture<FString> Future = EasySettingsIniShards::LoadingShards.Add(Shard).AddDefaulted_GetRef().GetFuture();
+
+	// The worker loads into a config cache of its own, GConfig is only touched once the result is back on the game thread.
+	Async(EAsyncExecution::ThreadPool, [Shard, BaseIniName = GetBaseIniName(Shard)]()
+	{
+		TSharedRef<FConfigCacheIni, ESPMode::ThreadSafe> LocalConfig = MakeShared<FConfigCacheIni, ESPMode::ThreadSafe>(EConfigCacheType::Temporary);
+
+		FString IniFileName;
+		const bool bLoaded = FConfigCacheIni::LoadGlobalIniFile(IniFileName, *BaseIniName, nullptr, false, false, true, true, *FPaths::GeneratedConfigDir(), &LocalConfig.Get());
+
+		AsyncTask(ENamedThreads::GameThread, [Shard, BaseIniName, LocalConfig, IniFileName, bLoaded]()
+		{
+			// A synchronous GetIniFileName may have loaded the shard in the meantime, in which case GConfig already has the newer copy.
+			if (const FString* AlreadyLoaded = EasySettingsIniShards::LoadedShards.Find(Shard))
+			{
+				EasySettingsIniShards::FinishLoading(Shard, *AlreadyLoaded);
+				return;
+			}
+
+			if (bLoaded)
+			{
+				GConfig->SetFile(IniFileName, LocalConfig->FindConfigFile(IniFileName));
+			}
+			else
+			{
+				UE_LOG(LogEasySettings, Warning, TEXT("Failed to load ini shard %s, it will be created on the first flush."), *BaseIniName);
+			}
+
+			EasySettingsIniShards::LoadedShards.Add(Shard, IniFileName);
+			EasySettingsIniShards::FinishLoading(Shard, IniFileName);
+		});
+	});
+
+	return Future;
+}
@@ -0,0 +1,156 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsIniWatcher.h"
+#include "EasySettings.h"
+#include "EasySettingsSnapshot.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+
+struct FEasySettingsIniWatcher::FPoll
+{
+	struct FFile
+	{
+		FString IniFileName;
+		FString PathOnDisk;
+		FDateTime KnownTimeStamp;
+		TSet<FString> Sections;
+
+		/** Written by the worker. */
+		FDateTime NewTimeStamp;
+		bool bChanged = false;
+		TMap<FString, FConfigSection> ChangedSections;
+	};
+
+	TArray<FFile> Files;
+	TFuture<void> Task;
+};
+
+FEasySettingsIniWatcher::FEasySettingsIniWatcher()
+{
+}
+
+FEasySettingsIniWatcher::~FEasySettingsIniWatcher()
+{
+	Reset();
+}
+
+void FEasySettingsIniWatcher::Watch(const FString& IniFileName)
+{
+	if (WatchedFiles.Contains(IniFileName))
+	{
+		return;
+	}
+
+	WatchedFiles.Add(IniFileName, IFileManager::Get().GetTimeStamp(*FEasySettingsSnapshot::GetIniFilePathOnDisk(IniFileName)));
+}
+
+void FEasySettingsIniWatcher::Reset()
+{
+	if (InFlightPoll.IsValid())
+	{
+		InFlightPoll->Task.Wait();
+		InFlightPoll.Reset();
+	}
+
+	WatchedFiles.Reset();
+}
+
+void FEasySettingsIniWatcher::NotifyWritten(const FString& IniFileName)
+{
+	if (FDateTime* KnownTimeStamp = WatchedFiles.Find(IniFileName))
+	{
+		*KnownTimeStamp = IFileManager::Get().GetTimeStamp(*FEasySettingsSnapshot::GetIniFilePathOnDisk(IniFileName));
+	}
+}
+
+void FEasySettingsIniWatcher::BeginPoll(TMap<FString, TSet<FString>>&& SectionsByIniFile)
+{
+	if (InFlightPoll.IsValid())
+	{
+		return;
+	}
+
+	TSharedRef<FPoll, ESPMode::ThreadSafe> Poll = MakeShared<FPoll, ESPMode::ThreadSafe>();
+	for (TPair<FString, TSet<FString>>& Sections : SectionsByIniFile)
+	{
+		if (const FDateTime* KnownTimeStamp = WatchedFiles.Find(Sections.Key))
+		{
+			FPoll::FFile& File = Poll->Files.AddDefaulted_GetRef();
+			File.IniFileName = Sections.Key;
+			File.PathOnDisk = FEasySettingsSnapshot::GetIniFilePathOnDisk(Sections.Key);
+			File.KnownTimeStamp = *KnownTimeStamp;
+			File.Sections = MoveTemp(Sections.Value);
+		}
+	}
+
+	if (Poll->Files.Num() == 0)
+	{
+		return;
+	}
+
+	// The worker only touches the poll it was handed, never GConfig or the watcher.
+	Poll->Task = Async(EAsyncExecution::ThreadPool, [Poll]()
+	{
+		for (FPoll::FFile& File : Poll->Files)
+		{
+			File.NewTimeStamp = IFileManager::Get().GetTimeStamp(*File.PathOnDisk);
+			if (File.NewTimeStamp == FDateTime::MinValue() || File.NewTimeStamp == File.KnownTimeStamp)
+			{
+				continue;
+			}
+
+			FString Contents;
+			if (!FFileHelper::LoadFileToString(Contents, *File.PathOnDisk))
+			{
+				// Most likely still being written, the next poll will see it again.
+				File.NewTimeStamp = File.KnownTimeStamp;
+				continue;
+			}
+
+			FConfigFile Parsed;
+			Parsed.ProcessInputFileContents(Contents, File.PathOnDisk);
+
+			// Keep only what the caller cares about, so the game thread never walks unrelated sections.
+			for (const FString& Section : File.Sections)
+			{
+				if (const FConfigSection* ParsedSection = Parsed.Find(Section))
+				{
+					File.ChangedSections.Add(Section, *ParsedSection);
+				}
+			}
+			File.bChanged = true;
+		}
+	});
+
+	InFlightPoll = Poll;
+}
+
+bool FEasySettingsIniWatcher::TryFinishPoll(TFunctionRef<void(const FString& IniFileName, const TMap<FString, FConfigSection>& Sections)> OnIniFileChanged)
+{
+	if (!InFlightPoll.IsValid() || !InFlightPoll->Task.IsReady())
+	{
+		return false;
+	}
+
+	const TSharedRef<FPoll, ESPMode::ThreadSafe> Poll = InFlightPoll.ToSharedRef();
+	InFlightPoll.Reset();
+
+	for (const FPoll::FFile& File : Poll->Files)
+	{
+		FDateTime* KnownTimeStamp = WatchedFiles.Find(File.IniFileName);
+
+		// Skip files that were written through GConfig while the poll was running, NotifyWritten already moved their baseline past the poll.
+		if (!KnownTimeStamp || !File.bChanged || File.NewTimeStamp <= *KnownTimeStamp)
+		{
+			continue;
+		}
+
+		*KnownTimeStamp = File.NewTimeStamp;
+		UE_LOG(LogEasySettings, Log, TEXT("%s was changed outside of the game, reloading %d watched sections."), *File.IniFileName, File.ChangedSections.Num());
+		OnIniFileChanged(File.IniFileName, File.ChangedSections);
+	}
+
+	return true;
+}
@@ -0,0 +1,208 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsJournal.h"
+#include "EasySettings.h"
+#include "EasySettingsSnapshot.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FEasySettingsJournal::FEasySettingsJournal()
+{
+}
+
+FEasySettingsJournal::~FEasySettingsJournal()
+{
+	Close();
+}
+
+bool FEasySettingsJournal::Open(const FString& InFilename)
+{
+	Close();
+	Filename = InFilename;
+
+	TArray<uint8> Bytes;
+	if (FFileHelper::LoadFileToArray(Bytes, *Filename, FILEREAD_Silent) && Bytes.Num() > 0)
+	{
+		const FHeader* Header = reinterpret_cast<const FHeader*>(Bytes.GetData());
+		if (Bytes.Num() < int32(sizeof(FHeader)) || Header->Magic != JournalMagic || Header->Version != JournalVersion)
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("Ignoring malformed settings journal %s, settings will be read from the ini files."), *Filename);
+			IFileManager::Get().Delete(*Filename);
+		}
+		else
+		{
+			// A record cut short by a crash is ignored, every record before it is complete.
+			const int32 NumRecords = (Bytes.Num() - sizeof(FHeader)) / sizeof(FRecord);
+			const FRecord* Records = reinterpret_cast<const FRecord*>(Bytes.GetData() + sizeof(FHeader));
+			for (int32 Index = 0; Index < NumRecords; ++Index)
+			{
+				Latest.Add(Records[Index].KeyHash, Records[Index]);
+			}
+			// Records left over from the last session count towards the next compaction.
+			NumAppended = NumRecords;
+
+			if (Bytes.Num() != int32(sizeof(FHeader) + NumRecords * sizeof(FRecord)))
+			{
+				UE_LOG(LogEasySettings, Warning, TEXT("Settings journal %s ends with a partial record, it was dropped."), *Filename);
+				Bytes.SetNum(sizeof(FHeader) + NumRecords * sizeof(FRecord));
+				FFileHelper::SaveArrayToFile(Bytes, *Filename);
+			}
+		}
+	}
+
+	return OpenForAppend();
+}
+
+void FEasySettingsJournal::Close()
+{
+	TryFinishCompaction(true);
+
+	FileHandle.Reset();
+	Filename.Reset();
+	Latest.Reset();
+	NumAppended = 0;
+}
+
+bool FEasySettingsJournal::TryFind(uint64 KeyHash, ESettingType Type, uint32& OutValueBits) const
+{
+	if (Latest.Num() == 0)
+	{
+		return false;
+	}
+
+	const FRecord* Record = Latest.Find(KeyHash);
+	if (!Record || Record->Type != uint8(Type))
+	{
+		return false;
+	}
+
+	OutValueBits = Record->ValueBits;
+	return true;
+}
+
+bool FEasySettingsJournal::Contains(uint64 KeyHash) const
+{
+	return Latest.Num() > 0 && Latest.Contains(KeyHash);
+}
+
+void FEasySettingsJournal::Append(uint64 KeyHash, ESettingType Type, uint32 ValueBits)
+{
+	FRecord Record;
+	Record.KeyHash = KeyHash;
+	Record.ValueBits = ValueBits;
+	Record.Type = uint8(Type);
+
+	Latest.Add(Record.KeyHash, Record);
+
+	if (IsCompacting())
+	{
+		HeldRecords.Add(Record);
+		return;
+	}
+
+	WriteRecords(MakeArrayView(&Record, 1));
+}
+
+void FEasySettingsJournal::BeginCompaction(const TArray<uint64>& FoldedKeys)
+{
+	if (!IsOpen() || IsCompacting())
+	{
+		return;
+	}
+
+	for (const uint64 KeyHash : FoldedKeys)
+	{
+		Latest.Remove(KeyHash);
+	}
+
+	// What is left belongs to settings that weren't set up this session, so they couldn't be folded.
+	TArray<uint8> Bytes;
+	FHeader Header;
+	Header.Magic = JournalMagic;
+	Header.Version = JournalVersion;
+	Bytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+	for (const TPair<uint64, FRecord>& Record : Latest)
+	{
+		Bytes.Append(reinterpret_cast<const uint8*>(&Record.Value), sizeof(FRecord));
+	}
+	NumAppended = 0;
+
+	// The handle is reopened once the worker has swapped the files.
+	FileHandle.Reset();
+
+	CompactionTask = Async(EAsyncExecution::ThreadPool, [Bytes = MoveTemp(Bytes), Filename = Filename]()
+	{
+		const FString TempFilename = Filename + TEXT(".tmp");
+		return FFileHelper::SaveArrayToFile(Bytes, *TempFilename) && IFileManager::Get().Move(*Filename, *TempFilename, true, true);
+	});
+}
+
+bool FEasySettingsJournal::TryFinishCompaction(bool bWait)
+{
+	if (!CompactionTask.IsValid())
+	{
+		return true;
+	}
+
+	if (!bWait && !CompactionTask.IsReady())
+	{
+		return false;
+	}
+
+	if (!CompactionTask.Get())
+	{
+		// The old file is still in place and holds every record, including the folded ones, which replay to the values now in the ini.
+		UE_LOG(LogEasySettings, Warning, TEXT("Failed to compact settings journal %s, it will be compacted again later."), *Filename);
+	}
+	CompactionTask = TFuture<bool>();
+
+	OpenForAppend();
+	WriteRecords(HeldRecords);
+	HeldRecords.Reset();
+	return true;
+}
+
+FString FEasySettingsJournal::GetDefaultFilename()
+{
+	return FPaths::Combine(FPaths::GetPath(FEasySettingsSnapshot::GetIniFilePathOnDisk(GGameUserSettingsIni)), TEXT("EasySettings.journal"));
+}
+
+bool FEasySettingsJournal::OpenForAppend()
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const bool bNewFile = PlatformFile.FileSize(*Filename) <= 0;
+
+	FileHandle.Reset(PlatformFile.OpenWrite(*Filename, true, false));
+	if (!FileHandle.IsValid())
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("Failed to open settings journal %s, settings will be flushed to the ini files instead."), *Filename);
+		Filename.Reset();
+		return false;
+	}
+
+	if (bNewFile)
+	{
+		FHeader Header;
+		Header.Magic = JournalMagic;
+		Header.Version = JournalVersion;
+		FileHandle->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+		FileHandle->Flush();
+	}
+
+	return true;
+}
+
+void FEasySettingsJournal::WriteRecords(TArrayView<const FRecord> Records)
+{
+	if (!FileHandle.IsValid() || Records.Num() == 0)
+	{
+		return;
+	}
+
+	FileHandle->Write(reinterpret_cast<const uint8*>(Records.GetData()), Records.Num() * sizeof(FRecord));
+	FileHandle->Flush();
+	NumAppended += Records.Num();
+}
@@ -0,0 +1,95 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsOptionSets.h"
+
+SIZE_T FEasySettingsOptionSet::GetAllocatedSize() const
+{
+	SIZE_T Size = Options.GetAllocatedSize() + Tokens.GetAllocatedSize() + Lookup.GetAllocatedSize() + GetNamesAllocatedSize();
+	for (const TPair<FString, int32>& Entry : Lookup)
+	{
+		Size += Entry.Key.GetAllocatedSize();
+	}
+	return Size;
+}
+
+SIZE_T FEasySettingsOptionSet::GetNamesAllocatedSize() const
+{
+	SIZE_T Size = 0;
+	for (int32 Index = 0; Index < Options.Num(); ++Index)
+	{
+		Size += Options[Index].GetAllocatedSize() + Tokens[Index].GetAllocatedSize();
+	}
+	return Size;
+}
+
+const FEasySettingsOptionSet& FEasySettingsOptionSetTable::Intern(TArrayView<const FString> Options)
+{
+	const uint32 Hash = HashOptions(Options);
+
+	TArray<int32, TInlineAllocator<4>> Candidates;
+	SetsByHash.MultiFind(Hash, Candidates);
+	for (const int32 Candidate : Candidates)
+	{
+		const FEasySettingsOptionSet& Set = *Sets[Candidate];
+		if (Set.Num() != Options.Num())
+		{
+			continue;
+		}
+
+		// FString's operator== ignores case, but sets differing only by case hand back different names.
+		bool bMatches = true;
+		for (int32 Index = 0; Index < Options.Num() && bMatches; ++Index)
+		{
+			bMatches = Set.Options[Index].Equals(Options[Index], ESearchCase::CaseSensitive);
+		}
+
+		if (bMatches)
+		{
+			return Set;
+		}
+	}
+
+	FEasySettingsOptionSet& Set = *Sets.Add_GetRef(MakeUnique<FEasySettingsOptionSet>());
+	Set.Options.Append(Options.GetData(), Options.Num());
+	Set.Tokens.Reserve(Options.Num());
+	Set.Lookup.Reserve(Options.Num());
+	for (int32 Index = 0; Index < Options.Num(); ++Index)
+	{
+		Set.Tokens.Add(Options[Index].ToLower());
+
+		// Options that only differ by case would be ambiguous in the ini, the first one wins.
+		if (!Set.Lookup.Contains(Options[Index]))
+		{
+			Set.Lookup.Add(Options[Index], Index);
+		}
+	}
+
+	SetsByHash.Add(Hash, Sets.Num() - 1);
+	return Set;
+}
+
+SIZE_T FEasySettingsOptionSetTable::GetAllocatedSize() const
+{
+	SIZE_T Size = Sets.GetAllocatedSize() + SetsByHash.GetAllocatedSize();
+	for (const TUniquePtr<FEasySettingsOptionSet>& Set : Sets)
+	{
+		Size += sizeof(FEasySettingsOptionSet) + Set->GetAllocatedSize();
+	}
+	return Size;
+}
+
+void FEasySettingsOptionSetTable::Reset()
+{
+	Sets.Empty();
+	SetsByHash.Empty();
+}
+
+uint32 FEasySettingsOptionSetTable::HashOptions(TArrayView<const FString> Options)
+{
+	uint32 Hash = ::GetTypeHash(Options.Num());
+	for (const FString& Option : Options)
+	{
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*Option));
+	}
+	return Hash;
+}
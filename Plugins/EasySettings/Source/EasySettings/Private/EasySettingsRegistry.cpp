@@ -0,0 +1,3818 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsRegistry.h"
+#include "EasySettings.h"
+#include "EasySettingsPreset.h"
+#include "EasySettingsSchema.h"
+#include "EasySettingsStats.h"
+#include "Algo/Sort.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UnrealType.h"
+
+namespace EasySettings
+{
+	/** Returns the GConfig file name for an ini file, @see FSettingBase::GetIniFileName. */
+	static FString GetIniFileName(EIniFile IniFile)
+	{
+		FSettingBase FileID;
+		FileID.IniFile = IniFile;
+		return FileID.GetIniFileName();
+	}
+
+	/** Section of a profile's ini file holding its overrides, keyed by TMapKey. */
+	static const TCHAR* ProfileSection = TEXT("Overrides");
+
+	/** Returns the ini shard a profile is persisted in, @see UEasySettingsRegistry::CreateProfile. */
+	static FName GetProfileShard(FName ProfileName)
+	{
+		return FName(*FString::Printf(TEXT("Profile_%s"), *ProfileName.ToString()));
+	}
+
+	/** Section derived settings are registered under, @see UEasySettingsRegistry::RegisterDerivedSetting. Nothing is ever written to it. */
+	static const TCHAR* DerivedSection = TEXT("EasySettings.Derived");
+
+	/** Returns true if settings of the given type can be an input of a derived setting, which only takes values that convert to a float. */
+	static bool CanDeriveFrom(ESettingType Type)
+	{
+		switch (Type)
+		{
+		case ESettingType::Float:
+		case ESettingType::OpposingToggles:
+		case ESettingType::Enum:
+		case ESettingType::Int:
+		case ESettingType::Bool:
+		case ESettingType::Derived:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/** Returns true if a member of type ValueType can hold the value of a setting of the given type, @see UEasySettingsRegistry::BindMemberToSetting. */
+	template <typename ValueType>
+	static bool CanBindMember(ESettingType Type)
+	{
+		if constexpr (std::is_same_v<ValueType, float>)
+		{
+			return Type == ESettingType::Float || Type == ESettingType::Derived;
+		}
+		else if constexpr (std::is_same_v<ValueType, bool>)
+		{
+			return Type == ESettingType::OpposingToggles || Type == ESettingType::Bool;
+		}
+		else if constexpr (std::is_same_v<ValueType, int32>)
+		{
+			return Type == ESettingType::Enum || Type == ESettingType::Int;
+		}
+		else if constexpr (std::is_same_v<ValueType, FVector2D>)
+		{
+			return Type == ESettingType::Vector2D;
+		}
+		else if constexpr (std::is_same_v<ValueType, FLinearColor>)
+		{
+			return Type == ESettingType::LinearColor;
+		}
+		else
+		{
+			static_assert(std::is_same_v<ValueType, FKey>, "Settings can only be bound to float, bool, int32, FVector2D, FLinearColor or FKey members.");
+			return Type == ESettingType::Key;
+		}
+	}
+
+	/** Returns true if the property holds exactly the given struct. */
+	static bool IsStructProperty(const FProperty* Property, const UScriptStruct* Struct)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		return StructProperty && StructProperty->Struct == Struct;
+	}
+
+	/** Returns the section as stored in GConfig, or nullptr if the ini file or section doesn't exist yet. */
+	static const FConfigSection* FindConfigSection(const FString& Section, const FString& IniFileName)
+	{
+		EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_ConfigRead);
+
+		return GConfig->GetSectionPrivate(*Section, false, true, IniFileName);
+	}
+
+	/** Looks a key up in a section without parsing or copying its value. */
+	static const FConfigValue* FindConfigValue(const FConfigSection* ConfigSection, const FString& Key)
+	{
+		if (!ConfigSection)
+		{
+			return nullptr;
+		}
+
+		// A key that was never turned into an FName can't be in any section, so don't add it to the name table.
+		const FName KeyName(*Key, FNAME_Find);
+		return KeyName.IsNone() ? nullptr : ConfigSection->Find(KeyName);
+	}
+
+	/**
+	 * Looks a setting's key up in its section. Sharded settings that aren't in their shard yet fall back to the ini they are migrated from.
+	 * @param bOutMigrated	True if the value came from the old ini, in which case it still has to be written to the shard.
+	 */
+	static const FConfigValue* FindSettingValue(const FSettingBase& ID, const FConfigSection* ConfigSection, bool& bOutMigrated)
+	{
+		bOutMigrated = false;
+
+		if (const FConfigValue* ConfigValue = FindConfigValue(ConfigSection, ID.Key))
+		{
+			return ConfigValue;
+		}
+
+		if (ID.IniFile != EIniFile::Sharded || ID.MigrateFrom == EIniFile::Sharded)
+		{
+			return nullptr;
+		}
+
+		const FConfigValue* LegacyValue = FindConfigValue(FindConfigSection(ID.Section, GetIniFileName(ID.MigrateFrom)), ID.Key);
+		bOutMigrated = LegacyValue != nullptr;
+		return LegacyValue;
+	}
+}
+
+UEasySettingsRegistry* UEasySettingsRegistry::Instance = nullptr;
+
+UEasySettingsRegistry* UEasySettingsRegistry::TryGetForCaller(const TCHAR* FunctionName)
+{
+	if (!Instance)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("%s() called while the EasySettings registry is not available, most likely during engine shutdown. Nothing was done."), FunctionName);
+	}
+	return Instance;
+}
+
+void UEasySettingsRegistry::Initialize()
+{
+	check(!Instance);
+	Instance = this;
+
+	if (bUseSettingsSnapshot)
+	{
+		Snapshot.Load(FEasySettingsSnapshot::GetDefaultFilename());
+	}
+
+	if (bUseSettingsJournal)
+	{
+		Journal.Open(FEasySettingsJournal::GetDefaultFilename());
+	}
+
+	if (bCoalesceChangeNotifications)
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UEasySettingsRegistry::FlushPendingNotifications);
+	}
+
+	if (bWatchIniFiles)
+	{
+		IniWatchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEasySettingsRegistry::TickIniWatcher), IniWatchInterval);
+	}
+}
+
+void UEasySettingsRegistry::Deinitialize()
+{
+	if (IniWatchTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(IniWatchTickerHandle);
+		IniWatchTickerHandle.Reset();
+	}
+	IniWatcher.Reset();
+
+	RollbackTransaction();
+
+	// A preview was never accepted, so the persisted values are the ones to flush and snapshot.
+	TArray<FSettingHandle> RevertedHandles;
+	RevertPreview(RevertedHandles);
+
+	// Same for the settings' own values, which the snapshot and the journal describe.
+	SetActiveProfile(NAME_None, RevertedHandles);
+
+	// Listeners are still bound, so deliver what was coalesced rather than dropping it.
+	FlushPendingNotifications();
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+	UpdateDerivedSettings();
+	FCoreDelegates::OnEndFrame.Remove(DerivedEndFrameHandle);
+	DerivedEndFrameHandle.Reset();
+
+	// Fold the journal back in, so the ini files hold every value once the game has exited.
+	if (JournalTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(JournalTickerHandle);
+		JournalTickerHandle.Reset();
+	}
+	if (Journal.IsOpen())
+	{
+		Journal.TryFinishCompaction(true);
+		CompactJournal();
+		Journal.Close();
+	}
+
+	// Nothing that was accepted by an update should be lost because the flush was deferred.
+	FlushDirtyIniFiles();
+
+	if (bUseSettingsSnapshot)
+	{
+		WriteSettingsSnapshot();
+	}
+	Snapshot.Reset();
+
+	Slots.Empty();
+	SlotMetadata.Empty();
+	FreeSlots.Empty();
+	HandlesByKey.Empty();
+	FloatStorage = FFloatSettingStorage();
+	OpposingTogglesStorage = FOpposingTogglesStorage();
+	EnumStorage = FEnumSettingStorage();
+	OptionSetTable.Reset();
+	GenericStorages = FGenericSettingStorages();
+	DerivedStorage = FDerivedSettingStorage();
+	DerivedDependents.Empty();
+	DirtyDerivedSettings.Empty();
+	PendingFloatSettings.Empty();
+	PendingOpposingTogglesSettings.Empty();
+	PendingEnumSettings.Empty();
+	NonDefaultCount = 0;
+	ResolvingSettings.Empty();
+	Profiles.Empty();
+
+	FloatSettingChangedDelegate.Clear();
+	OpposingTogglesSettingChangedDelegate.Clear();
+	EnumSettingChangedDelegate.Clear();
+	SettingChangedDelegate.Clear();
+	SettingsCommittedDelegate.Clear();
+
+	if (Instance == this)
+	{
+		Instance = nullptr;
+	}
+}
+
+FSettingHandle UEasySettingsRegistry::SetupFloatSetting(FFloatSetting& Setting, bool& bOutSuccess)
+{
+	const FString IniFileName = Setting.GetIniFileName();
+
+	bool bNeedsDefault;
+	const FSettingHandle Handle = RegisterFloatSetting(Setting, EasySettings::FindConfigSection(Setting.Section, IniFileName), bOutSuccess, bNeedsDefault);
+	if (bNeedsDefault)
+	{
+		// We didn't find any usable value in the config file, so set it in ini as the default value.
+		WriteFloatSetting(Handle, Slots[Handle.GetIndex()].TypedIndex, Setting.Current);
+		MarkIniDirty(IniFileName);
+	}
+
+	// With a profile active, the setting shows the profile's value, its own value stays in the ini file.
+	if (!ActiveProfile.IsNone() && ResolveProfileValue(Handle))
+	{
+		TryGetFloatValue(Handle, Setting.Current);
+	}
+
+	return Handle;
+}
+
+FSettingHandle UEasySettingsRegistry::SetupOpposingTogglesSetting(FOpposingTogglesSetting& Setting)
+{
+	const FString IniFileName = Setting.GetIniFileName();
+
+	bool bNeedsDefault;
+	const FSettingHandle Handle = RegisterOpposingTogglesSetting(Setting, EasySettings::FindConfigSection(Setting.Section, IniFileName), bNeedsDefault);
+	if (bNeedsDefault)
+	{
+		// Overwrite whatever was there with the default toggle.
+		WriteOpposingTogglesSetting(Handle, Slots[Handle.GetIndex()].TypedIndex, Setting.bFirstIsActive);
+		MarkIniDirty(IniFileName);
+	}
+
+	// With a profile active, the setting shows the profile's value, its own value stays in the ini file.
+	if (!ActiveProfile.IsNone() && ResolveProfileValue(Handle))
+	{
+		TryGetOpposingTogglesValue(Handle, Setting.bFirstIsActive);
+	}
+
+	return Handle;
+}
+
+FSettingHandle UEasySettingsRegistry::SetupEnumSetting(FEnumSetting& Setting, bool& bOutSuccess)
+{
+	const FString IniFileName = Setting.GetIniFileName();
+
+	bool bNeedsDefault;
+	const FSettingHandle Handle = RegisterEnumSetting(Setting, EasySettings::FindConfigSection(Setting.Section, IniFileName), bOutSuccess, bNeedsDefault);
+	if (bNeedsDefault)
+	{
+		// We didn't find any usable option in the config file, so set it in ini as the default value.
+		WriteEnumSetting(Handle, Slots[Handle.GetIndex()].TypedIndex, Setting.Current);
+		MarkIniDirty(IniFileName);
+	}
+
+	// With a profile active, the setting shows the profile's value, its own value stays in the ini file.
+	if (!ActiveProfile.IsNone() && ResolveProfileValue(Handle))
+	{
+		TryGetEnumValue(Handle, Setting.Current);
+	}
+
+	return Handle;
+}
+
+TFuture<FSettingHandle> UEasySettingsRegistry::SetupFloatSettingAsync(const FFloatSetting& Setting)
+{
+	return SetupSettingAsync(Setting, ESettingType::Float, [this, Setting]() mutable
+	{
+		bool bSuccess;
+		return SetupFloatSetting(Setting, bSuccess);
+	});
+}
+
+TFuture<FSettingHandle> UEasySettingsRegistry::SetupOpposingTogglesSettingAsync(const FOpposingTogglesSetting& Setting)
+{
+	return SetupSettingAsync(Setting, ESettingType::OpposingToggles, [this, Setting]() mutable
+	{
+		return SetupOpposingTogglesSetting(Setting);
+	});
+}
+
+TFuture<FSettingHandle> UEasySettingsRegistry::SetupEnumSettingAsync(const FEnumSetting& Setting)
+{
+	return SetupSettingAsync(Setting, ESettingType::Enum, [this, Setting]() mutable
+	{
+		bool bSuccess;
+		return SetupEnumSetting(Setting, bSuccess);
+	});
+}
+
+TFuture<FSettingHandle> UEasySettingsRegistry::SetupSettingAsync(const FSettingBase& SettingID, ESettingType Type, TUniqueFunction<FSettingHandle()>&& Setup)
+{
+	const FString TMapKey = SettingID.GetTMapKey();
+	FSettingHandle ExistingHandle;
+	if (FindRegisteredSetting(TMapKey, Type, ExistingHandle))
+	{
+		return MakeFulfilledPromise<FSettingHandle>(ExistingHandle).GetFuture();
+	}
+
+	// Every ini file but a shard that hasn't been used yet is loaded by the engine on boot, so setting up is only a lookup in memory.
+	if (SettingID.IniFile != EIniFile::Sharded || FEasySettingsIniShards::IsLoaded(SettingID.Shard))
+	{
+		return MakeFulfilledPromise<FSettingHandle>(FinishSetupAsync(Setup)).GetFuture();
+	}
+
+	++ResolvingSettings.FindOrAdd(TMapKey);
+
+	// The shard finishes loading on the game thread, so the continuation runs there too.
+	TWeakObjectPtr<UEasySettingsRegistry> WeakThis(this);
+	return FEasySettingsIniShards::LoadAsync(SettingID.Shard).Then([WeakThis, TMapKey, Type, Setup = MoveTemp(Setup)](TFuture<FString>&&) mutable
+	{
+		UEasySettingsRegistry* Registry = WeakThis.Get();
+		if (!Registry || Registry != Instance)
+		{
+			return FSettingHandle();
+		}
+
+		int32& Resolving = Registry->ResolvingSettings.FindChecked(TMapKey);
+		if (--Resolving == 0)
+		{
+			Registry->ResolvingSettings.Remove(TMapKey);
+		}
+
+		// Another Setup may have registered the setting while the shard was loading.
+		FSettingHandle ExistingHandle;
+		if (Registry->FindRegisteredSetting(TMapKey, Type, ExistingHandle))
+		{
+			return ExistingHandle;
+		}
+
+		return Registry->FinishSetupAsync(Setup);
+	});
+}
+
+FSettingHandle UEasySettingsRegistry::FinishSetupAsync(TUniqueFunction<FSettingHandle()>& Setup)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_FinishSetupAsync);
+
+	FSettingHandle Handle;
+	{
+		TGuardValue<bool> DeferIniFlushes(bDeferIniFlushes, true);
+		Handle = Setup();
+	}
+
+	// Anything that read the setting before it was set up saw nothing, so tell it about the resolved value.
+	if (Handle.IsValid())
+	{
+		DispatchSettingChanged(Handle);
+	}
+
+	return Handle;
+}
+
+void UEasySettingsRegistry::RegisterSettings(const UEasySettingsSchema* Schema, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+	FEasySettingsGenericHandles& OutGenericHandles)
+{
+	if (!Schema)
+	{
+		OutFloatHandles.Reset();
+		OutOpposingTogglesHandles.Reset();
+		OutEnumHandles.Reset();
+		OutGenericHandles = FEasySettingsGenericHandles();
+		UE_LOG(LogEasySettings, Warning, TEXT("RegisterSettings() called without a schema. Nothing was registered."));
+		return;
+	}
+
+	// The schema is an asset, resolve into copies rather than modifying it.
+	TArray<FFloatSetting> FloatSettings = Schema->FloatSettings;
+	TArray<FOpposingTogglesSetting> OpposingTogglesSettings = Schema->OpposingTogglesSettings;
+	TArray<FEnumSetting> EnumSettings = Schema->EnumSettings;
+	TArray<FIntSetting> IntSettings = Schema->IntSettings;
+	TArray<FBoolSetting> BoolSettings = Schema->BoolSettings;
+	TArray<FVector2DSetting> Vector2DSettings = Schema->Vector2DSettings;
+	TArray<FLinearColorSetting> LinearColorSettings = Schema->LinearColorSettings;
+	TArray<FKeySetting> KeySettings = Schema->KeySettings;
+	const FGenericSettingViews GenericSettings(IntSettings, BoolSettings, Vector2DSettings, LinearColorSettings, KeySettings);
+	RegisterSettings(FloatSettings, OpposingTogglesSettings, EnumSettings, GenericSettings, Schema->GetBakedSettings(), OutFloatHandles, OutOpposingTogglesHandles, OutEnumHandles, OutGenericHandles);
+}
+
+void UEasySettingsRegistry::RegisterSettings(TArrayView<FFloatSetting> FloatSettings, TArrayView<FOpposingTogglesSetting> OpposingTogglesSettings, TArrayView<FEnumSetting> EnumSettings, const FGenericSettingViews& GenericSettings,
+	TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles, FEasySettingsGenericHandles& OutGenericHandles)
+{
+	RegisterSettings(FloatSettings, OpposingTogglesSettings, EnumSettings, GenericSettings, {}, OutFloatHandles, OutOpposingTogglesHandles, OutEnumHandles, OutGenericHandles);
+}
+
+void UEasySettingsRegistry::RegisterSettings(TArrayView<FFloatSetting> FloatSettings, TArrayView<FOpposingTogglesSetting> OpposingTogglesSettings, TArrayView<FEnumSetting> EnumSettings,
+	TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles)
+{
+	FEasySettingsGenericHandles GenericHandles;
+	RegisterSettings(FloatSettings, OpposingTogglesSettings, EnumSettings, FGenericSettingViews(), {}, OutFloatHandles, OutOpposingTogglesHandles, OutEnumHandles, GenericHandles);
+}
+
+void UEasySettingsRegistry::RegisterSettings(TArrayView<FFloatSetting> FloatSettings, TArrayView<FOpposingTogglesSetting> OpposingTogglesSettings, TArrayView<FEnumSetting> EnumSettings, const FGenericSettingViews& GenericSettings,
+	TArrayView<const FEasySettingsBakedSetting> BakedSettings, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+	FEasySettingsGenericHandles& OutGenericHandles)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_RegisterSettings);
+
+	OutFloatHandles.Reset();
+	OutFloatHandles.SetNum(FloatSettings.Num());
+	OutOpposingTogglesHandles.Reset();
+	OutOpposingTogglesHandles.SetNum(OpposingTogglesSettings.Num());
+	OutEnumHandles.Reset();
+	OutEnumHandles.SetNum(EnumSettings.Num());
+
+	int32 NumSettings = FloatSettings.Num() + OpposingTogglesSettings.Num() + EnumSettings.Num();
+	VisitTupleElements([&OutGenericHandles, &NumSettings](const auto& Settings)
+	{
+		using SettingType = typename std::decay_t<decltype(Settings)>::ElementType;
+
+		TArray<FSettingHandle>& Handles = OutGenericHandles.Get<SettingType>();
+		Handles.Reset();
+		Handles.SetNum(Settings.Num());
+		NumSettings += Settings.Num();
+	}, GenericSettings);
+
+	// Visit the settings grouped by ini file and section, so each section is only looked up once.
+	struct FPendingSetting
+	{
+		const FSettingBase* ID;
+		ESettingType Type;
+		int32 Index;
+		const FEasySettingsBakedSetting* Baked;
+	};
+
+	TArray<FPendingSetting> Pending;
+	Pending.Reserve(NumSettings);
+
+	// A cooked schema is already in registration order, with its keys and hashes worked out.
+	if (BakedSettings.Num() > 0 && BakedSettings.Num() == NumSettings)
+	{
+		for (const FEasySettingsBakedSetting& Baked : BakedSettings)
+		{
+			switch (ESettingType(Baked.Type))
+			{
+			case ESettingType::Float:
+				Pending.Add({ &FloatSettings[Baked.Index], ESettingType::Float, Baked.Index, &Baked });
+				break;
+			case ESettingType::OpposingToggles:
+				Pending.Add({ &OpposingTogglesSettings[Baked.Index], ESettingType::OpposingToggles, Baked.Index, &Baked });
+				break;
+			case ESettingType::Enum:
+				Pending.Add({ &EnumSettings[Baked.Index], ESettingType::Enum, Baked.Index, &Baked });
+				break;
+			default:
+				// One of the types in EASYSETTINGS_FOR_EACH_GENERIC_SETTING.
+				VisitTupleElements([&Pending, &Baked](const auto& Settings)
+				{
+					using FTraits = TSettingTraits<typename std::decay_t<decltype(Settings)>::ElementType>;
+
+					if (ESettingType(Baked.Type) == FTraits::Type)
+					{
+						Pending.Add({ &Settings[Baked.Index], FTraits::Type, Baked.Index, &Baked });
+					}
+				}, GenericSettings);
+				break;
+			}
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < FloatSettings.Num(); ++Index)
+		{
+			Pending.Add({ &FloatSettings[Index], ESettingType::Float, Index, nullptr });
+		}
+		for (int32 Index = 0; Index < OpposingTogglesSettings.Num(); ++Index)
+		{
+			Pending.Add({ &OpposingTogglesSettings[Index], ESettingType::OpposingToggles, Index, nullptr });
+		}
+		for (int32 Index = 0; Index < EnumSettings.Num(); ++Index)
+		{
+			Pending.Add({ &EnumSettings[Index], ESettingType::Enum, Index, nullptr });
+		}
+		VisitTupleElements([&Pending](const auto& Settings)
+		{
+			using FTraits = TSettingTraits<typename std::decay_t<decltype(Settings)>::ElementType>;
+
+			for (int32 Index = 0; Index < Settings.Num(); ++Index)
+			{
+				Pending.Add({ &Settings[Index], FTraits::Type, Index, nullptr });
+			}
+		}, GenericSettings);
+
+		Algo::Sort(Pending, [](const FPendingSetting& A, const FPendingSetting& B)
+		{
+			return UEasySettingsSchema::RegistrationOrderLess(*A.ID, *B.ID);
+		});
+	}
+
+	// Defaults are written after every section has been read, as adding a section to GConfig may move the ones we are reading.
+	TArray<FSettingHandle> NeedsDefault;
+
+	FString IniFileName;
+	const FSettingBase* GroupID = nullptr;
+	const FConfigSection* ConfigSection = nullptr;
+	for (const FPendingSetting& Setting : Pending)
+	{
+		if (!GroupID || GroupID->IniFile != Setting.ID->IniFile || (GroupID->IniFile == EIniFile::Sharded && GroupID->Shard != Setting.ID->Shard)
+			|| !GroupID->Section.Equals(Setting.ID->Section, ESearchCase::IgnoreCase))
+		{
+			GroupID = Setting.ID;
+			IniFileName = GroupID->GetIniFileName();
+			ConfigSection = EasySettings::FindConfigSection(GroupID->Section, IniFileName);
+		}
+
+		bool bSuccess;
+		bool bNeedsDefault = false;
+		FSettingHandle Handle;
+		switch (Setting.Type)
+		{
+		case ESettingType::Float:
+			Handle = RegisterFloatSetting(FloatSettings[Setting.Index], ConfigSection, bSuccess, bNeedsDefault, Setting.Baked);
+			OutFloatHandles[Setting.Index] = Handle;
+			break;
+		case ESettingType::OpposingToggles:
+			Handle = RegisterOpposingTogglesSetting(OpposingTogglesSettings[Setting.Index], ConfigSection, bNeedsDefault, Setting.Baked);
+			OutOpposingTogglesHandles[Setting.Index] = Handle;
+			break;
+		case ESettingType::Enum:
+			Handle = RegisterEnumSetting(EnumSettings[Setting.Index], ConfigSection, bSuccess, bNeedsDefault, Setting.Baked);
+			OutEnumHandles[Setting.Index] = Handle;
+			break;
+		default:
+			// One of the types in EASYSETTINGS_FOR_EACH_GENERIC_SETTING.
+			VisitTupleElements([this, &Setting, ConfigSection, &bSuccess, &bNeedsDefault, &Handle, &OutGenericHandles](const auto& Settings)
+			{
+				using SettingType = typename std::decay_t<decltype(Settings)>::ElementType;
+
+				if (Setting.Type == TSettingTraits<SettingType>::Type)
+				{
+					Handle = RegisterSetting<SettingType>(Settings[Setting.Index], ConfigSection, bSuccess, bNeedsDefault, Setting.Baked);
+					OutGenericHandles.Get<SettingType>()[Setting.Index] = Handle;
+				}
+			}, GenericSettings);
+			break;
+		}
+
+		if (bNeedsDefault)
+		{
+			NeedsDefault.Add(Handle);
+		}
+	}
+
+	// There are only a handful of ini files, so a small inline array is cheaper than a set.
+	TArray<FString, TInlineAllocator<4>> TouchedIniFiles;
+	for (const FSettingHandle& Handle : NeedsDefault)
+	{
+		const FSettingSlot& Slot = Slots[Handle.GetIndex()];
+		switch (Slot.Type)
+		{
+		case ESettingType::Float:
+			WriteFloatSetting(Handle, Slot.TypedIndex, FloatStorage.Current[Slot.TypedIndex]);
+			break;
+		case ESettingType::OpposingToggles:
+			WriteOpposingTogglesSetting(Handle, Slot.TypedIndex, OpposingTogglesStorage.bFirstIsActive[Slot.TypedIndex]);
+			break;
+		case ESettingType::Enum:
+			WriteEnumSetting(Handle, Slot.TypedIndex, EnumStorage.Current[Slot.TypedIndex]);
+			break;
+		default:
+			VisitTupleElements([this, &Slot, Handle](const auto& Storage)
+			{
+				using FStorage = std::decay_t<decltype(Storage)>;
+
+				if (Slot.Type == FStorage::Type)
+				{
+					WriteSetting<typename FStorage::SettingType>(Handle, Slot.TypedIndex, Storage.Current[Slot.TypedIndex]);
+				}
+			}, GenericStorages);
+			break;
+		}
+		TouchedIniFiles.AddUnique(SlotMetadata[Handle.GetIndex()].ID.GetIniFileName());
+	}
+
+	for (const FString& TouchedIniFile : TouchedIniFiles)
+	{
+		MarkIniDirty(TouchedIniFile);
+	}
+
+	// With a profile active, the settings show the profile's values, their own values stay in the ini files.
+	if (!ActiveProfile.IsNone())
+	{
+		for (int32 Index = 0; Index < FloatSettings.Num(); ++Index)
+		{
+			ResolveProfileValue(OutFloatHandles[Index]);
+			TryGetFloatValue(OutFloatHandles[Index], FloatSettings[Index].Current);
+		}
+		for (int32 Index = 0; Index < OpposingTogglesSettings.Num(); ++Index)
+		{
+			ResolveProfileValue(OutOpposingTogglesHandles[Index]);
+			TryGetOpposingTogglesValue(OutOpposingTogglesHandles[Index], OpposingTogglesSettings[Index].bFirstIsActive);
+		}
+		for (int32 Index = 0; Index < EnumSettings.Num(); ++Index)
+		{
+			if (OutEnumHandles[Index].IsValid())
+			{
+				ResolveProfileValue(OutEnumHandles[Index]);
+				TryGetEnumValue(OutEnumHandles[Index], EnumSettings[Index].Current);
+			}
+		}
+		VisitTupleElements([this, &OutGenericHandles](const auto& Settings)
+		{
+			using SettingType = typename std::decay_t<decltype(Settings)>::ElementType;
+
+			const TArray<FSettingHandle>& Handles = OutGenericHandles.Get<SettingType>();
+			for (int32 Index = 0; Index < Settings.Num(); ++Index)
+			{
+				if (Handles[Index].IsValid())
+				{
+					ResolveProfileValue(Handles[Index]);
+					TryGetValue<SettingType>(Handles[Index], Settings[Index].Current);
+				}
+			}
+		}, GenericSettings);
+	}
+}
+
+FSettingHandle UEasySettingsRegistry::RegisterFloatSetting(FFloatSetting& Setting, const FConfigSection* ConfigSection, bool& bOutSuccess, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked)
+{
+	bOutSuccess = false;
+	bOutNeedsDefault = false;
+
+	const FString IniFileName = Setting.GetIniFileName();
+	const FString TMapKey = Baked ? Baked->TMapKey : Setting.GetTMapKey();
+	const uint64 KeyHash = Baked ? Baked->KeyHash : FEasySettingsSnapshot::HashKey(TMapKey);
+
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Setup);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*TMapKey);
+
+	// The Default we fall back to whenever the Current value ends up outside Min and Max. A cooked schema's Defaults were checked by the cook.
+	float DefaultFloat = 0.f;
+	const bool bDefaultIsValid = Baked || Setting.ValidateFloatSetting(Setting.Default);
+	if (bDefaultIsValid)
+	{
+		DefaultFloat = Setting.Default;
+	}
+
+	FSettingHandle ExistingHandle;
+	if (FindRegisteredSetting(TMapKey, ESettingType::Float, ExistingHandle))
+	{
+		if (ExistingHandle.IsValid())
+		{
+			// Don't overwrite a setting that was already setup, hand back the existing entry instead.
+			UE_LOG(LogEasySettings, Error, TEXT("This FloatSetting was already setup. Setting TMap key was %s"), *TMapKey);
+			Setting.Current = FloatStorage.Current[ResolveTypedIndex(ExistingHandle, ESettingType::Float)];
+			bOutSuccess = bDefaultIsValid;
+		}
+		return ExistingHandle;
+	}
+
+	// Check the journal and the snapshot first, then whether the setting is in the config file yet.
+	float FloatReceived = 0.f;
+	uint32 SnapshotBits;
+	bool bFound = false;
+	bool bMigrated = false;
+	const bool bJournaled = Journal.TryFind(KeyHash, ESettingType::Float, SnapshotBits);
+	if (bJournaled || Snapshot.TryFind(KeyHash, Baked ? Baked->SchemaHash : FEasySettingsSnapshot::GetFloatSchemaHash(Setting.Min, Setting.Max), IniFileName, SnapshotBits))
+	{
+		FMemory::Memcpy(&FloatReceived, &SnapshotBits, sizeof(FloatReceived));
+		bFound = true;
+	}
+	else if (const FConfigValue* ConfigValue = EasySettings::FindSettingValue(Setting, ConfigSection, bMigrated))
+	{
+		FloatReceived = FCString::Atof(*ConfigValue->GetValue());
+		bFound = true;
+	}
+
+	bool bUsedDefault = false;
+	if (bFound && Setting.ValidateFloatSetting(FloatReceived))
+	{
+		// Successfully found a usable float in the ini.
+		Setting.Current = FloatReceived;
+		bOutSuccess = true;
+	}
+	else
+	{
+		if (bDefaultIsValid)
+		{
+			bOutSuccess = true;
+		}
+		else
+		{
+			// Print error to log if the struct was set up incorrectly.
+			UE_LOG(LogEasySettings, Error, TEXT("Setting.Default was not within Min and Max values. Setting the Default for this to 0. Setting TMap key was %s"), *TMapKey);
+		}
+
+		Setting.Current = DefaultFloat;
+		bUsedDefault = true;
+	}
+
+	const FSettingHandle Handle = AllocateSlot(Setting, TMapKey, KeyHash, ESettingType::Float);
+	Slots[Handle.GetIndex()].TypedIndex = FloatStorage.Add(Handle.GetIndex(), Setting.Current, Setting.Min, Setting.Max, DefaultFloat);
+	ValueTable->PublishFloat(Handle, Setting.Current);
+	RefreshNonDefault(Handle);
+
+	bOutNeedsDefault = bUsedDefault || bMigrated;
+	// GConfig is what profiles fall back to and what compaction flushes, so it has to hold the journaled value too.
+	if (bJournaled && !bOutNeedsDefault)
+	{
+		WriteCurrentToConfig(Handle.GetIndex());
+	}
+	return Handle;
+}
+
+FSettingHandle UEasySettingsRegistry::RegisterOpposingTogglesSetting(FOpposingTogglesSetting& Setting, const FConfigSection* ConfigSection, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked)
+{
+	bOutNeedsDefault = false;
+
+	const FString IniFileName = Setting.GetIniFileName();
+	const FString TMapKey = Baked ? Baked->TMapKey : Setting.GetTMapKey();
+	const uint64 KeyHash = Baked ? Baked->KeyHash : FEasySettingsSnapshot::HashKey(TMapKey);
+
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Setup);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*TMapKey);
+
+	FSettingHandle ExistingHandle;
+	if (FindRegisteredSetting(TMapKey, ESettingType::OpposingToggles, ExistingHandle))
+	{
+		if (ExistingHandle.IsValid())
+		{
+			// Don't overwrite a setting that was already setup, hand back the existing entry instead.
+			UE_LOG(LogEasySettings, Error, TEXT("This OpposingTogglesSettings was already setup. Setting TMap key was %s"), *TMapKey);
+			Setting.bFirstIsActive = OpposingTogglesStorage.bFirstIsActive[ResolveTypedIndex(ExistingHandle, ESettingType::OpposingToggles)];
+		}
+		return ExistingHandle;
+	}
+
+	// The journal and the snapshot already hold the parsed toggle, so there is no string to compare.
+	uint32 SnapshotBits;
+	bool bFound = false;
+	bool bMigrated = false;
+	const bool bJournaled = Journal.TryFind(KeyHash, ESettingType::OpposingToggles, SnapshotBits);
+	if (bJournaled || Snapshot.TryFind(KeyHash, Baked ? Baked->SchemaHash : FEasySettingsSnapshot::GetOpposingTogglesSchemaHash(Setting.FirstToggle, Setting.SecondToggle), IniFileName, SnapshotBits))
+	{
+		Setting.bFirstIsActive = SnapshotBits != 0;
+		bFound = true;
+	}
+	// Check if the setting is in the config file yet.
+	else if (const FConfigValue* ConfigValue = EasySettings::FindSettingValue(Setting, ConfigSection, bMigrated))
+	{
+		switch (Setting.ParseOpposingToggleSetting(ConfigValue->GetValue()))
+		{
+		case 1:
+			Setting.bFirstIsActive = true;
+			bFound = true;
+			break;
+		case 2:
+			Setting.bFirstIsActive = false;
+			bFound = true;
+			break;
+		}
+	}
+
+	if (!bFound)
+	{
+		// The string we found in the ini file didn't match our FirstToggle or SecondToggle or wasn't there.
+		// Fall back to the default, the caller overwrites what is there.
+		Setting.bFirstIsActive = Setting.bFirstIsDefault;
+		UE_LOG(LogEasySettings, Warning, TEXT("Stored OpposingTogglesSettings did not match either the first or second toggles or was not present in the ini file. Overwriting with default. Setting TMap key was %s"), *TMapKey);
+	}
+
+	const FSettingHandle Handle = AllocateSlot(Setting, TMapKey, KeyHash, ESettingType::OpposingToggles);
+	Slots[Handle.GetIndex()].TypedIndex = OpposingTogglesStorage.Add(Handle.GetIndex(), Setting, OptionSetTable.Intern({ Setting.FirstToggle, Setting.SecondToggle }));
+	ValueTable->PublishBool(Handle, Setting.bFirstIsActive);
+	RefreshNonDefault(Handle);
+
+	bOutNeedsDefault = !bFound || bMigrated;
+	// GConfig is what profiles fall back to and what compaction flushes, so it has to hold the journaled value too.
+	if (bJournaled && !bOutNeedsDefault)
+	{
+		WriteCurrentToConfig(Handle.GetIndex());
+	}
+	return Handle;
+}
+
+FSettingHandle UEasySettingsRegistry::RegisterEnumSetting(FEnumSetting& Setting, const FConfigSection* ConfigSection, bool& bOutSuccess, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked)
+{
+	bOutSuccess = false;
+	bOutNeedsDefault = false;
+
+	const FString IniFileName = Setting.GetIniFileName();
+	const FString TMapKey = Baked ? Baked->TMapKey : Setting.GetTMapKey();
+	const uint64 KeyHash = Baked ? Baked->KeyHash : FEasySettingsSnapshot::HashKey(TMapKey);
+
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Setup);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*TMapKey);
+
+	if (!Baked && Setting.Options.Num() == 0)
+	{
+		// There is nothing we could write to the ini, so don't register it at all.
+		UE_LOG(LogEasySettings, Error, TEXT("EnumSetting has no Options and was not setup. Setting TMap key was %s"), *TMapKey);
+		return FSettingHandle();
+	}
+
+	// The Default we fall back to whenever the ini holds something that isn't one of the Options.
+	int32 DefaultIndex = 0;
+	if (Baked || Setting.ValidateEnumSetting(Setting.Default))
+	{
+		DefaultIndex = Setting.Default;
+		bOutSuccess = true;
+	}
+	else
+	{
+		// Print error to log if the struct was set up incorrectly.
+		UE_LOG(LogEasySettings, Error, TEXT("Setting.Default was not the index of one of the Options. Setting the Default for this to 0. Setting TMap key was %s"), *TMapKey);
+	}
+
+	FSettingHandle ExistingHandle;
+	if (FindRegisteredSetting(TMapKey, ESettingType::Enum, ExistingHandle))
+	{
+		if (ExistingHandle.IsValid())
+		{
+			// Don't overwrite a setting that was already setup, hand back the existing entry instead.
+			UE_LOG(LogEasySettings, Error, TEXT("This EnumSetting was already setup. Setting TMap key was %s"), *TMapKey);
+			Setting.Current = EnumStorage.Current[ResolveTypedIndex(ExistingHandle, ESettingType::Enum)];
+		}
+		else
+		{
+			bOutSuccess = false;
+		}
+		return ExistingHandle;
+	}
+
+	// Register first so the ini value is parsed through the new entry's lookup table.
+	Setting.Current = DefaultIndex;
+	const FSettingHandle Handle = AllocateSlot(Setting, TMapKey, KeyHash, ESettingType::Enum);
+	const int32 TypedIndex = EnumStorage.Add(Handle.GetIndex(), Setting, DefaultIndex, OptionSetTable.Intern(Setting.Options));
+	Slots[Handle.GetIndex()].TypedIndex = TypedIndex;
+
+	// Check the journal and the snapshot first, then whether the setting is in the config file yet.
+	int32 ReceivedIndex = INDEX_NONE;
+	uint32 SnapshotBits;
+	bool bMigrated = false;
+	const bool bJournaled = Journal.TryFind(KeyHash, ESettingType::Enum, SnapshotBits);
+	if (bJournaled || Snapshot.TryFind(KeyHash, Baked ? Baked->SchemaHash : FEasySettingsSnapshot::GetEnumSchemaHash(Setting.Options), IniFileName, SnapshotBits))
+	{
+		ReceivedIndex = int32(SnapshotBits);
+	}
+	else if (const FConfigValue* ConfigValue = EasySettings::FindSettingValue(Setting, ConfigSection, bMigrated))
+	{
+		ReceivedIndex = EnumStorage.ParseOption(TypedIndex, ConfigValue->GetValue());
+	}
+
+	if (EnumStorage.IsValid(TypedIndex, ReceivedIndex))
+	{
+		// Successfully found a usable option in the ini.
+		Setting.Current = ReceivedIndex;
+		EnumStorage.Current[TypedIndex] = ReceivedIndex;
+		bOutNeedsDefault = bMigrated;
+	}
+	else
+	{
+		bOutNeedsDefault = true;
+	}
+
+	ValueTable->PublishInt(Handle, Setting.Current);
+	RefreshNonDefault(Handle);
+
+	// GConfig is what profiles fall back to and what compaction flushes, so it has to hold the journaled value too.
+	if (bJournaled && !bOutNeedsDefault)
+	{
+		WriteCurrentToConfig(Handle.GetIndex());
+	}
+	return Handle;
+}
+
+template <typename SettingType>
+FSettingHandle UEasySettingsRegistry::SetupSetting(SettingType& Setting, bool& bOutSuccess)
+{
+	const FString IniFileName = Setting.GetIniFileName();
+
+	bool bNeedsDefault;
+	const FSettingHandle Handle = RegisterSetting(Setting, EasySettings::FindConfigSection(Setting.Section, IniFileName), bOutSuccess, bNeedsDefault);
+	if (bNeedsDefault)
+	{
+		// We didn't find any usable value in the config file, so set it in ini as the default value.
+		WriteSetting<SettingType>(Handle, Slots[Handle.GetIndex()].TypedIndex, Setting.Current);
+		MarkIniDirty(IniFileName);
+	}
+
+	// With a profile active, the setting shows the profile's value, its own value stays in the ini file.
+	if (!ActiveProfile.IsNone() && ResolveProfileValue(Handle))
+	{
+		TryGetValue<SettingType>(Handle, Setting.Current);
+	}
+
+	return Handle;
+}
+
+template <typename SettingType>
+FSettingHandle UEasySettingsRegistry::RegisterSetting(SettingType& Setting, const FConfigSection* ConfigSection, bool& bOutSuccess, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked)
+{
+	using FTraits = TSettingTraits<SettingType>;
+	using ValueType = typename FTraits::ValueType;
+
+	bOutSuccess = false;
+	bOutNeedsDefault = false;
+
+	const FString IniFileName = Setting.GetIniFileName();
+	const FString TMapKey = Baked ? Baked->TMapKey : Setting.GetTMapKey();
+	const uint64 KeyHash = Baked ? Baked->KeyHash : FEasySettingsSnapshot::HashKey(TMapKey);
+
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Setup);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*TMapKey);
+
+	const typename FTraits::FRules Rules = FTraits::GetRules(Setting);
+
+	// The Default we fall back to whenever the ini holds something the validator rejects. A cooked schema's Defaults were checked by the cook.
+	ValueType DefaultValue = Setting.Default;
+	if (Baked || FTraits::IsValid(Rules, DefaultValue))
+	{
+		bOutSuccess = true;
+	}
+	else
+	{
+		// Print error to log if the struct was set up incorrectly.
+		DefaultValue = FTraits::MakeValid(Rules, DefaultValue);
+		UE_LOG(LogEasySettings, Error, TEXT("Setting.Default did not pass the setting's validator. Setting the Default for this to %s. Setting TMap key was %s"), *FTraits::ToString(DefaultValue), *TMapKey);
+	}
+
+	FSettingHandle ExistingHandle;
+	if (FindRegisteredSetting(TMapKey, FTraits::Type, ExistingHandle))
+	{
+		if (ExistingHandle.IsValid())
+		{
+			// Don't overwrite a setting that was already setup, hand back the existing entry instead.
+			UE_LOG(LogEasySettings, Error, TEXT("This setting was already setup. Setting TMap key was %s"), *TMapKey);
+			TryGetValue<SettingType>(ExistingHandle, Setting.Current);
+		}
+		else
+		{
+			bOutSuccess = false;
+		}
+		return ExistingHandle;
+	}
+
+	// Check the journal and the snapshot first, for types whose value fits in them, then whether the setting is in the config file yet.
+	ValueType Received = DefaultValue;
+	bool bFound = false;
+	bool bMigrated = false;
+	bool bJournaled = false;
+	if constexpr (FTraits::bHasValueBits)
+	{
+		uint32 SnapshotBits;
+		bJournaled = Journal.TryFind(KeyHash, FTraits::Type, SnapshotBits);
+		if (bJournaled || Snapshot.TryFind(KeyHash, Baked ? Baked->SchemaHash : FTraits::GetSchemaHash(Rules), IniFileName, SnapshotBits))
+		{
+			Received = FTraits::FromBits(SnapshotBits);
+			bFound = true;
+		}
+	}
+
+	if (!bFound)
+	{
+		if (const FConfigValue* ConfigValue = EasySettings::FindSettingValue(Setting, ConfigSection, bMigrated))
+		{
+			bFound = FTraits::Parse(ConfigValue->GetValue(), Received);
+		}
+	}
+
+	if (bFound && FTraits::IsValid(Rules, Received))
+	{
+		// Successfully found a usable value in the ini.
+		Setting.Current = Received;
+		bOutNeedsDefault = bMigrated;
+	}
+	else
+	{
+		Setting.Current = DefaultValue;
+		bOutNeedsDefault = true;
+	}
+
+	const FSettingHandle Handle = AllocateSlot(Setting, TMapKey, KeyHash, FTraits::Type);
+	Slots[Handle.GetIndex()].TypedIndex = GetStorage<SettingType>().Add(Handle.GetIndex(), Setting.Current, DefaultValue, Rules);
+
+	if constexpr (FTraits::bHasValueBits)
+	{
+		ValueTable->PublishInt(Handle, int32(FTraits::ToBits(Setting.Current)));
+	}
+	RefreshNonDefault(Handle);
+
+	// GConfig is what profiles fall back to and what compaction flushes, so it has to hold the journaled value too.
+	if (bJournaled && !bOutNeedsDefault)
+	{
+		WriteCurrentToConfig(Handle.GetIndex());
+	}
+	return Handle;
+}
+
+FSettingHandle UEasySettingsRegistry::RegisterDerivedSetting(FName Name, TArrayView<const FSettingHandle> Inputs, FDerivedSettingFunction&& Function)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_RegisterDerivedSetting);
+
+	if (Name.IsNone() || !Function)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("RegisterDerivedSetting() was called without a name or a function. Nothing was registered."));
+		return FSettingHandle();
+	}
+
+	FSettingBase SettingID;
+	SettingID.Section = EasySettings::DerivedSection;
+	SettingID.Key = Name.ToString();
+	const FString TMapKey = SettingID.GetTMapKey();
+
+	FSettingHandle ExistingHandle;
+	if (FindRegisteredSetting(TMapKey, ESettingType::Derived, ExistingHandle))
+	{
+		if (ExistingHandle.IsValid())
+		{
+			// Same as the Setup functions, hand back the existing entry rather than replacing its function.
+			UE_LOG(LogEasySettings, Error, TEXT("This derived setting was already registered. Setting TMap key was %s"), *TMapKey);
+		}
+		return ExistingHandle;
+	}
+
+	for (const FSettingHandle& Input : Inputs)
+	{
+		if (!EasySettings::CanDeriveFrom(GetSettingType(Input)))
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("RegisterDerivedSetting() was called with an input that is stale or doesn't convert to a float. Nothing was registered. Setting TMap key was %s"), *TMapKey);
+			return FSettingHandle();
+		}
+	}
+
+	const FSettingHandle Handle = AllocateSlot(SettingID, TMapKey, 0, ESettingType::Derived);
+	const int32 TypedIndex = DerivedStorage.Add(Handle.GetIndex(), Inputs, MoveTemp(Function));
+	Slots[Handle.GetIndex()].TypedIndex = TypedIndex;
+
+	for (const FSettingHandle& Input : Inputs)
+	{
+		DerivedDependents.FindOrAdd(Input).AddUnique(Handle);
+	}
+
+	// Computed straight away, so the first change has a value to compare against.
+	DerivedStorage.Notified[TypedIndex] = EvaluateDerivedSetting(TypedIndex);
+
+	if (!DerivedEndFrameHandle.IsValid())
+	{
+		DerivedEndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UEasySettingsRegistry::UpdateDerivedSettings);
+	}
+
+	return Handle;
+}
+
+FSettingHandle UEasySettingsRegistry::RegisterDerivedSetting(FName Name, TArrayView<const FSettingHandle> Inputs, FDerivedSettingDynamicFunction Function)
+{
+	if (!Function.IsBound())
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("RegisterDerivedSetting() was called with an unbound event. Nothing was registered. Name was %s"), *Name.ToString());
+		return FSettingHandle();
+	}
+
+	// Blueprints only take a TArray, so the inputs are copied on every recompute.
+	return RegisterDerivedSetting(Name, Inputs, [Function](TArrayView<const float> InputValues)
+	{
+		return Function.IsBound() ? Function.Execute(TArray<float>(InputValues)) : 0.f;
+	});
+}
+
+bool UEasySettingsRegistry::TryGetDerivedValue(FSettingHandle Handle, float& OutValue)
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Derived);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutValue = EvaluateDerivedSetting(TypedIndex);
+	return true;
+}
+
+void UEasySettingsRegistry::UpdateDerivedSettings()
+{
+	if (DirtyDerivedSettings.Num() == 0)
+	{
+		return;
+	}
+
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_UpdateDerivedSettings);
+
+	// Listeners may update settings again, the derived settings that marks dirty are checked at the next end of frame.
+	TArray<FSettingHandle> Changed = MoveTemp(DirtyDerivedSettings);
+	DirtyDerivedSettings.Reset();
+
+	// Recompute everything before notifying anyone, so listeners reading other derived settings see this frame's values.
+	for (int32 Index = Changed.Num() - 1; Index >= 0; --Index)
+	{
+		const int32 TypedIndex = ResolveTypedIndex(Changed[Index], ESettingType::Derived);
+		if (TypedIndex == INDEX_NONE || EvaluateDerivedSetting(TypedIndex) == DerivedStorage.Notified[TypedIndex])
+		{
+			Changed.RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+		DerivedStorage.Notified[TypedIndex] = DerivedStorage.Value[TypedIndex];
+	}
+
+	for (const FSettingHandle& Handle : Changed)
+	{
+		WriteSettingBindings(Handle);
+		NotifySettingChanged(Handle);
+		BroadcastGlobalDelegate(Handle);
+	}
+}
+
+void UEasySettingsRegistry::MarkDerivedDirty(FSettingHandle Handle)
+{
+	const TArray<FSettingHandle, TInlineAllocator<4>>* Dependents = DerivedDependents.Find(Handle);
+	if (!Dependents)
+	{
+		return;
+	}
+
+	for (const FSettingHandle& Dependent : *Dependents)
+	{
+		// A dirty setting's dependents are already dirty, as reading a setting recomputes its dirty inputs first.
+		const int32 TypedIndex = ResolveTypedIndex(Dependent, ESettingType::Derived);
+		if (TypedIndex == INDEX_NONE || DerivedStorage.bDirty[TypedIndex])
+		{
+			continue;
+		}
+
+		DerivedStorage.bDirty[TypedIndex] = true;
+		DirtyDerivedSettings.Add(Dependent);
+		MarkDerivedDirty(Dependent);
+	}
+}
+
+float UEasySettingsRegistry::EvaluateDerivedSetting(int32 TypedIndex)
+{
+	if (!DerivedStorage.bDirty[TypedIndex])
+	{
+		return DerivedStorage.Value[TypedIndex];
+	}
+
+	const int32 SlotIndex = DerivedStorage.SlotIndices[TypedIndex];
+	const FSettingHandle Handle(SlotIndex, Slots[SlotIndex].Generation);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*GetTraceName(Handle));
+
+	// Inputs are registered before the settings derived from them, so this never comes back around to TypedIndex.
+	const TArray<FSettingHandle>& Inputs = DerivedStorage.Inputs[TypedIndex];
+	TArray<float, TInlineAllocator<8>> InputValues;
+	InputValues.SetNumUninitialized(Inputs.Num());
+	bool bInputsValid = true;
+	for (int32 Index = 0; Index < Inputs.Num() && bInputsValid; ++Index)
+	{
+		bInputsValid = TryGetDerivedInput(Inputs[Index], InputValues[Index]);
+	}
+
+	DerivedStorage.bDirty[TypedIndex] = false;
+	if (bInputsValid)
+	{
+		const float NewValue = DerivedStorage.Functions[TypedIndex](InputValues);
+		DerivedStorage.Value[TypedIndex] = NewValue;
+		ValueTable->PublishFloat(Handle, NewValue);
+	}
+
+	return DerivedStorage.Value[TypedIndex];
+}
+
+bool UEasySettingsRegistry::TryGetDerivedInput(FSettingHandle Handle, float& OutValue)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	const int32 TypedIndex = Slot->TypedIndex;
+	switch (Slot->Type)
+	{
+	case ESettingType::Float:
+		OutValue = FloatStorage.Current[TypedIndex];
+		return true;
+	case ESettingType::OpposingToggles:
+		OutValue = OpposingTogglesStorage.bFirstIsActive[TypedIndex] ? 1.f : 0.f;
+		return true;
+	case ESettingType::Enum:
+		OutValue = float(EnumStorage.Current[TypedIndex]);
+		return true;
+	case ESettingType::Derived:
+		OutValue = EvaluateDerivedSetting(TypedIndex);
+		return true;
+	default:
+	{
+		const ESettingType Type = Slot->Type;
+		bool bConverted = false;
+		VisitTupleElements([Type, TypedIndex, &OutValue, &bConverted](const auto& Storage)
+		{
+			using ValueType = typename std::decay_t<decltype(Storage)>::ValueType;
+
+			if constexpr (std::is_arithmetic_v<ValueType>)
+			{
+				if (Storage.Type == Type)
+				{
+					OutValue = float(Storage.Current[TypedIndex]);
+					bConverted = true;
+				}
+			}
+		}, GenericStorages);
+		return bConverted;
+	}
+	}
+}
+
+bool UEasySettingsRegistry::ReleaseSetting(FSettingHandle Handle)
+{
+	if (!ResolveSlot(Handle))
+	{
+		return false;
+	}
+
+	FSettingSlot& Slot = Slots[Handle.GetIndex()];
+	FSettingSlotMetadata& Metadata = SlotMetadata[Handle.GetIndex()];
+
+	ForgetPreviewedValue(Handle);
+	DiscardPendingValue(Handle);
+	if (Slot.bNonDefault)
+	{
+		--NonDefaultCount;
+	}
+
+	// Keep the typed storage dense by moving its last entry into the released one.
+	int32 MovedSlotIndex = INDEX_NONE;
+	switch (Slot.Type)
+	{
+	case ESettingType::Float:
+		MovedSlotIndex = FloatStorage.RemoveAtSwap(Slot.TypedIndex);
+		break;
+	case ESettingType::OpposingToggles:
+		MovedSlotIndex = OpposingTogglesStorage.RemoveAtSwap(Slot.TypedIndex);
+		break;
+	case ESettingType::Enum:
+		MovedSlotIndex = EnumStorage.RemoveAtSwap(Slot.TypedIndex);
+		break;
+	case ESettingType::Derived:
+		for (const FSettingHandle& Input : DerivedStorage.Inputs[Slot.TypedIndex])
+		{
+			if (TArray<FSettingHandle, TInlineAllocator<4>>* Dependents = DerivedDependents.Find(Input))
+			{
+				Dependents->RemoveSingleSwap(Handle, false);
+			}
+		}
+		MovedSlotIndex = DerivedStorage.RemoveAtSwap(Slot.TypedIndex);
+		break;
+	default:
+		VisitTupleElements([&Slot, &MovedSlotIndex](auto& Storage)
+		{
+			if (Storage.Type == Slot.Type)
+			{
+				MovedSlotIndex = Storage.RemoveAtSwap(Slot.TypedIndex);
+			}
+		}, GenericStorages);
+		break;
+	}
+
+	if (MovedSlotIndex != INDEX_NONE)
+	{
+		Slots[MovedSlotIndex].TypedIndex = Slot.TypedIndex;
+	}
+
+	const FString TMapKey = Metadata.ID.GetTMapKey();
+
+	// The handle goes stale, so profiles go back to keeping the overrides by key until the setting is set up again.
+	for (TPair<FName, FSettingsProfile>& Profile : Profiles)
+	{
+		if (const FString* Value = Profile.Value.Overlay->Find(Handle))
+		{
+			Profile.Value.Unresolved.Add(TMapKey, *Value);
+			Profile.Value.GetMutableOverlay().Remove(Handle);
+		}
+	}
+
+	HandlesByKey.Remove(TMapKey);
+	ValueTable->Retire(Handle);
+
+	// Derived settings computed from this one keep their last value, their stale input is skipped when the graph is walked.
+	DerivedDependents.Remove(Handle);
+
+	Metadata = FSettingSlotMetadata();
+	Slot.Listeners.Reset();
+	Slot.bNotifyOnEveryChange = false;
+	Slot.bNotificationPending = false;
+	Slot.bNonDefault = false;
+	Slot.Type = ESettingType::None;
+	Slot.TypedIndex = INDEX_NONE;
+	++Slot.Generation;
+
+	FreeSlots.Add(Handle.GetIndex());
+	bWatchedSectionsStale = true;
+	return true;
+}
+
+FSettingHandle UEasySettingsRegistry::FindHandle(const FString& TMapKey) const
+{
+	const FSettingHandle* Handle = HandlesByKey.Find(TMapKey);
+	if (!Handle)
+	{
+		INC_DWORD_STAT(STAT_EasySettings_LookupMisses);
+		return FSettingHandle();
+	}
+
+	return *Handle;
+}
+
+ESettingType UEasySettingsRegistry::GetSettingType(FSettingHandle Handle) const
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	return Slot ? Slot->Type : ESettingType::None;
+}
+
+const FSettingBase* UEasySettingsRegistry::GetSettingID(FSettingHandle Handle) const
+{
+	return ResolveSlot(Handle) ? &SlotMetadata[Handle.GetIndex()].ID : nullptr;
+}
+
+bool UEasySettingsRegistry::TryGetFloatValue(FSettingHandle Handle, float& OutCurrent) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Float);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutCurrent = FloatStorage.Current[TypedIndex];
+	return true;
+}
+
+bool UEasySettingsRegistry::GetFloatSettingView(FSettingHandle Handle, FFloatSettingView& OutView) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Float);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutView.Current = FloatStorage.Current[TypedIndex];
+	OutView.Min = FloatStorage.Min[TypedIndex];
+	OutView.Max = FloatStorage.Max[TypedIndex];
+	OutView.Default = FloatStorage.Default[TypedIndex];
+	OutView.ID = &SlotMetadata[Handle.GetIndex()].ID;
+	return true;
+}
+
+bool UEasySettingsRegistry::GetFloatSetting(FSettingHandle Handle, FFloatSetting& OutSetting) const
+{
+	FFloatSettingView View;
+	if (!GetFloatSettingView(Handle, View))
+	{
+		return false;
+	}
+
+	static_cast<FSettingBase&>(OutSetting) = *View.ID;
+	OutSetting.Current = View.Current;
+	OutSetting.Min = View.Min;
+	OutSetting.Max = View.Max;
+	OutSetting.Default = View.Default;
+	return true;
+}
+
+bool UEasySettingsRegistry::TryGetOpposingTogglesValue(FSettingHandle Handle, bool& bOutFirstIsActive) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::OpposingToggles);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	bOutFirstIsActive = OpposingTogglesStorage.bFirstIsActive[TypedIndex];
+	return true;
+}
+
+bool UEasySettingsRegistry::GetOpposingTogglesSetting(FSettingHandle Handle, FOpposingTogglesSetting& OutSetting) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::OpposingToggles);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	static_cast<FSettingBase&>(OutSetting) = SlotMetadata[Handle.GetIndex()].ID;
+	OutSetting.FirstToggle = OpposingTogglesStorage.GetToggle(TypedIndex, true);
+	OutSetting.SecondToggle = OpposingTogglesStorage.GetToggle(TypedIndex, false);
+	OutSetting.bFirstIsActive = OpposingTogglesStorage.bFirstIsActive[TypedIndex];
+	OutSetting.bFirstIsDefault = OpposingTogglesStorage.bFirstIsDefault[TypedIndex];
+	return true;
+}
+
+bool UEasySettingsRegistry::TryGetEnumValue(FSettingHandle Handle, int32& OutCurrent) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Enum);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutCurrent = EnumStorage.Current[TypedIndex];
+	return true;
+}
+
+bool UEasySettingsRegistry::GetEnumSetting(FSettingHandle Handle, FEnumSetting& OutSetting) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Enum);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	static_cast<FSettingBase&>(OutSetting) = SlotMetadata[Handle.GetIndex()].ID;
+	OutSetting.Options = EnumStorage.OptionSets[TypedIndex]->Options;
+	OutSetting.Current = EnumStorage.Current[TypedIndex];
+	OutSetting.Default = EnumStorage.Default[TypedIndex];
+	return true;
+}
+
+template <typename SettingType>
+bool UEasySettingsRegistry::TryGetValue(FSettingHandle Handle, typename TSettingTraits<SettingType>::ValueType& OutCurrent) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, TSettingTraits<SettingType>::Type);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutCurrent = GetStorage<SettingType>().Current[TypedIndex];
+	return true;
+}
+
+template <typename SettingType>
+bool UEasySettingsRegistry::GetSetting(FSettingHandle Handle, SettingType& OutSetting) const
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Get);
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, TSettingTraits<SettingType>::Type);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const TSettingStorage<SettingType>& Storage = GetStorage<SettingType>();
+	static_cast<FSettingBase&>(OutSetting) = SlotMetadata[Handle.GetIndex()].ID;
+	OutSetting.Current = Storage.Current[TypedIndex];
+	OutSetting.Default = Storage.Default[TypedIndex];
+	TSettingTraits<SettingType>::ApplyRules(Storage.Rules[TypedIndex], OutSetting);
+	return true;
+}
+
+FString UEasySettingsRegistry::GetTMapKey(FSettingHandle Handle) const
+{
+	return ResolveSlot(Handle) ? SlotMetadata[Handle.GetIndex()].ID.GetTMapKey() : FString();
+}
+
+const FString& UEasySettingsRegistry::GetTraceName(FSettingHandle Handle) const
+{
+	static const FString NoKey;
+
+	return ResolveSlot(Handle) ? SlotMetadata[Handle.GetIndex()].ID.Key : NoKey;
+}
+
+FSettingHandle UEasySettingsRegistry::AllocateSlot(const FSettingBase& SettingID, const FString& TMapKey, uint64 KeyHash, ESettingType Type)
+{
+	int32 Index;
+	if (FreeSlots.Num() > 0)
+	{
+		Index = FreeSlots.Pop(false);
+	}
+	else
+	{
+		Index = Slots.AddDefaulted();
+		SlotMetadata.AddDefaulted();
+	}
+
+	FSettingSlot& Slot = Slots[Index];
+	Slot.Type = Type;
+
+	FSettingSlotMetadata& Metadata = SlotMetadata[Index];
+	Metadata.ID = SettingID;
+	Metadata.KeyHash = KeyHash;
+
+	const FSettingHandle Handle(Index, Slot.Generation);
+	HandlesByKey.Add(TMapKey, Handle);
+	bWatchedSectionsStale = true;
+
+	// Profiles loaded before the setting was set up kept its overrides by key.
+	for (TPair<FName, FSettingsProfile>& Profile : Profiles)
+	{
+		FString Value;
+		if (Profile.Value.Unresolved.RemoveAndCopyValue(TMapKey, Value))
+		{
+			Profile.Value.GetMutableOverlay().Add(Handle, MoveTemp(Value));
+		}
+	}
+
+	return Handle;
+}
+
+int32 UEasySettingsRegistry::ResolveTypedIndex(FSettingHandle Handle, ESettingType Type) const
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	return Slot && Slot->Type == Type ? Slot->TypedIndex : INDEX_NONE;
+}
+
+bool UEasySettingsRegistry::FindRegisteredSetting(const FString& TMapKey, ESettingType Type, FSettingHandle& OutHandle) const
+{
+	OutHandle.Invalidate();
+
+	const FSettingHandle* ExistingHandle = HandlesByKey.Find(TMapKey);
+	if (!ExistingHandle)
+	{
+		return false;
+	}
+
+	// Another type's handle would fail every typed Get and Update, so don't hand it back.
+	if (GetSettingType(*ExistingHandle) != Type)
+	{
+		UE_LOG(LogEasySettings, Error, TEXT("A setting of another type was already setup with this key, nothing was setup. Setting TMap key was %s"), *TMapKey);
+		return true;
+	}
+
+	OutHandle = *ExistingHandle;
+	return true;
+}
+
+const UEasySettingsRegistry::FSettingSlot* UEasySettingsRegistry::ResolveSlot(FSettingHandle Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.GetIndex()))
+	{
+		INC_DWORD_STAT(STAT_EasySettings_LookupMisses);
+		return nullptr;
+	}
+
+	const FSettingSlot& Slot = Slots[Handle.GetIndex()];
+	if (Slot.Generation != Handle.GetGeneration() || Slot.Type == ESettingType::None)
+	{
+		INC_DWORD_STAT(STAT_EasySettings_LookupMisses);
+		return nullptr;
+	}
+
+	return &Slot;
+}
+
+FDelegateHandle UEasySettingsRegistry::SubscribeToSetting(FSettingHandle Handle, FOnSettingChanged::FDelegate&& Listener)
+{
+	FSettingSlot* Slot = ResolveMutableSlot(Handle);
+	if (!Slot)
+	{
+		return FDelegateHandle();
+	}
+
+	if (!Slot->Listeners.IsValid())
+	{
+		Slot->Listeners = MakeShared<FSettingListeners>();
+	}
+
+	++Slot->Listeners->NumNative;
+	return Slot->Listeners->Native.Add(MoveTemp(Listener));
+}
+
+void UEasySettingsRegistry::UnsubscribeFromSetting(FSettingHandle Handle, FDelegateHandle ListenerHandle)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (Slot && Slot->Listeners.IsValid() && Slot->Listeners->Native.Remove(ListenerHandle))
+	{
+		--Slot->Listeners->NumNative;
+	}
+}
+
+bool UEasySettingsRegistry::BindToSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event)
+{
+	FSettingSlot* Slot = ResolveMutableSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	if (!Slot->Listeners.IsValid())
+	{
+		Slot->Listeners = MakeShared<FSettingListeners>();
+	}
+
+	Slot->Listeners->Dynamic.AddUnique(Event);
+	return true;
+}
+
+void UEasySettingsRegistry::UnbindFromSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (Slot && Slot->Listeners.IsValid())
+	{
+		Slot->Listeners->Dynamic.Remove(Event);
+	}
+}
+
+template <typename ValueType>
+bool UEasySettingsRegistry::BindMemberToSetting(FSettingHandle Handle, UObject* Owner, ValueType* Member)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot || !Owner || !Member)
+	{
+		return false;
+	}
+
+	if (!EasySettings::CanBindMember<ValueType>(Slot->Type))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("BindMemberToSetting() called with a member that doesn't match the setting's value type. Nothing was bound. Setting TMap key was %s"), *GetTMapKey(Handle));
+		return false;
+	}
+
+	// Only the owner's lifetime keeps the address valid, so the member has to live inside it.
+	const UPTRINT OwnerStart = UPTRINT(Owner);
+	const UPTRINT MemberStart = UPTRINT(Member);
+	if (MemberStart < OwnerStart || MemberStart + sizeof(ValueType) > OwnerStart + Owner->GetClass()->GetStructureSize())
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("BindMemberToSetting() called with a member that is not part of %s. Nothing was bound. Setting TMap key was %s"), *Owner->GetName(), *GetTMapKey(Handle));
+		return false;
+	}
+
+	FSettingBinding Binding;
+	Binding.Owner = Owner;
+	Binding.Address = Member;
+	return AddSettingBinding(Handle, MoveTemp(Binding));
+}
+
+bool UEasySettingsRegistry::BindPropertyToSetting(FSettingHandle Handle, UObject* Object, FName PropertyName)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot || !Object)
+	{
+		return false;
+	}
+
+	FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), PropertyName);
+	if (!Property)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("BindPropertyToSetting() could not find a variable named %s on %s. Nothing was bound. Setting TMap key was %s"), *PropertyName.ToString(), *Object->GetName(), *GetTMapKey(Handle));
+		return false;
+	}
+
+	FSettingBinding Binding;
+	Binding.Owner = Object;
+	Binding.Address = Property->ContainerPtrToValuePtr<void>(Object);
+
+	bool bTypeMatches = false;
+	switch (Slot->Type)
+	{
+	case ESettingType::Float:
+	case ESettingType::Derived:
+		if (Property->IsA<FDoubleProperty>())
+		{
+			Binding.Kind = FSettingBinding::EKind::Double;
+			bTypeMatches = true;
+		}
+		else
+		{
+			bTypeMatches = Property->IsA<FFloatProperty>();
+		}
+		break;
+	case ESettingType::OpposingToggles:
+	case ESettingType::Bool:
+		Binding.BoolProperty = CastField<FBoolProperty>(Property);
+		Binding.Kind = FSettingBinding::EKind::BitfieldBool;
+		bTypeMatches = Binding.BoolProperty != nullptr;
+		break;
+	case ESettingType::Enum:
+	case ESettingType::Int:
+		bTypeMatches = Property->IsA<FIntProperty>();
+		break;
+	case ESettingType::Vector2D:
+		bTypeMatches = EasySettings::IsStructProperty(Property, TBaseStructure<FVector2D>::Get());
+		break;
+	case ESettingType::LinearColor:
+		bTypeMatches = EasySettings::IsStructProperty(Property, TBaseStructure<FLinearColor>::Get());
+		break;
+	case ESettingType::Key:
+		bTypeMatches = EasySettings::IsStructProperty(Property, FKey::StaticStruct());
+		break;
+	default:
+		break;
+	}
+
+	if (!bTypeMatches)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("BindPropertyToSetting() called with %s, whose type doesn't match the setting's value type. Nothing was bound. Setting TMap key was %s"), *PropertyName.ToString(), *GetTMapKey(Handle));
+		return false;
+	}
+
+	return AddSettingBinding(Handle, MoveTemp(Binding));
+}
+
+void UEasySettingsRegistry::UnbindObjectFromSetting(FSettingHandle Handle, UObject* Object)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (Slot && Slot->Listeners.IsValid())
+	{
+		Slot->Listeners->Bindings.RemoveAllSwap([Object](const FSettingBinding& Binding) { return Binding.Owner.Get() == Object; });
+	}
+}
+
+bool UEasySettingsRegistry::UpdateFloatSetting(FSettingHandle Handle, float NewCurrent)
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Update);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*GetTraceName(Handle));
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Float);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (!FloatStorage.IsValid(TypedIndex, NewCurrent))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("UpdateFloatSetting() called on a FloatSetting that was outside the Min and Max values. Nothing was changed. Setting TMap key was %s"), *GetTMapKey(Handle));
+		return false;
+	}
+
+	// Make sure the new setting is actually different than the old.
+	if (FloatStorage.Current[TypedIndex] == NewCurrent)
+	{
+		return false;
+	}
+
+	WriteFloatSetting(Handle, TypedIndex, NewCurrent, ActiveProfile.IsNone());
+	PersistSetting(Handle);
+
+	// Let listeners know of the change.
+	DispatchSettingChanged(Handle);
+	return true;
+}
+
+bool UEasySettingsRegistry::UpdateOpposingTogglesSetting(FSettingHandle Handle, bool bActivateFirst)
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Update);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*GetTraceName(Handle));
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::OpposingToggles);
+
+	// Make sure the new setting is actually different than the old.
+	if (TypedIndex == INDEX_NONE || OpposingTogglesStorage.bFirstIsActive[TypedIndex] == bActivateFirst)
+	{
+		return false;
+	}
+
+	WriteOpposingTogglesSetting(Handle, TypedIndex, bActivateFirst, ActiveProfile.IsNone());
+	PersistSetting(Handle);
+
+	// Let listeners know of the change.
+	DispatchSettingChanged(Handle);
+	return true;
+}
+
+bool UEasySettingsRegistry::UpdateEnumSetting(FSettingHandle Handle, int32 NewCurrent)
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Update);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*GetTraceName(Handle));
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Enum);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (!EnumStorage.IsValid(TypedIndex, NewCurrent))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("UpdateEnumSetting() called with an index that was not one of the Options. Nothing was changed. Setting TMap key was %s"), *GetTMapKey(Handle));
+		return false;
+	}
+
+	// Make sure the new setting is actually different than the old.
+	if (EnumStorage.Current[TypedIndex] == NewCurrent)
+	{
+		return false;
+	}
+
+	WriteEnumSetting(Handle, TypedIndex, NewCurrent, ActiveProfile.IsNone());
+	PersistSetting(Handle);
+
+	// Let listeners know of the change.
+	DispatchSettingChanged(Handle);
+	return true;
+}
+
+template <typename SettingType>
+bool UEasySettingsRegistry::UpdateSetting(FSettingHandle Handle, const typename TSettingTraits<SettingType>::ValueType& NewCurrent)
+{
+	using FTraits = TSettingTraits<SettingType>;
+
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Update);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*GetTraceName(Handle));
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, FTraits::Type);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TSettingStorage<SettingType>& Storage = GetStorage<SettingType>();
+	if (!Storage.IsValid(TypedIndex, NewCurrent))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("UpdateSetting() called with %s, which did not pass the setting's validator. Nothing was changed. Setting TMap key was %s"), *FTraits::ToString(NewCurrent), *GetTMapKey(Handle));
+		return false;
+	}
+
+	// Make sure the new setting is actually different than the old.
+	if (FTraits::Equals(Storage.Current[TypedIndex], NewCurrent))
+	{
+		return false;
+	}
+
+	WriteSetting<SettingType>(Handle, TypedIndex, NewCurrent, ActiveProfile.IsNone());
+	PersistSetting(Handle);
+
+	// Let listeners know of the change.
+	DispatchSettingChanged(Handle);
+	return true;
+}
+
+bool UEasySettingsRegistry::BeginTransaction()
+{
+	if (bTransactionOpen)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("BeginTransaction() called while a transaction was already open. Commit or roll back the open transaction first."));
+		return false;
+	}
+
+	bTransactionOpen = true;
+	return true;
+}
+
+bool UEasySettingsRegistry::StageFloatSetting(FSettingHandle Handle, float NewCurrent)
+{
+	if (!bTransactionOpen || ResolveTypedIndex(Handle, ESettingType::Float) == INDEX_NONE)
+	{
+		return false;
+	}
+
+	StagedFloatSettings.Add(Handle, NewCurrent);
+	return true;
+}
+
+bool UEasySettingsRegistry::StageOpposingTogglesSetting(FSettingHandle Handle, bool bActivateFirst)
+{
+	if (!bTransactionOpen || ResolveTypedIndex(Handle, ESettingType::OpposingToggles) == INDEX_NONE)
+	{
+		return false;
+	}
+
+	StagedOpposingTogglesSettings.Add(Handle, bActivateFirst);
+	return true;
+}
+
+bool UEasySettingsRegistry::StageEnumSetting(FSettingHandle Handle, int32 NewCurrent)
+{
+	if (!bTransactionOpen || ResolveTypedIndex(Handle, ESettingType::Enum) == INDEX_NONE)
+	{
+		return false;
+	}
+
+	StagedEnumSettings.Add(Handle, NewCurrent);
+	return true;
+}
+
+template <typename SettingType>
+bool UEasySettingsRegistry::StageSetting(FSettingHandle Handle, const typename TSettingTraits<SettingType>::ValueType& NewCurrent)
+{
+	if (!bTransactionOpen || ResolveTypedIndex(Handle, TSettingTraits<SettingType>::Type) == INDEX_NONE)
+	{
+		return false;
+	}
+
+	GetStorage<SettingType>().Staged.Add(Handle, NewCurrent);
+	return true;
+}
+
+bool UEasySettingsRegistry::CommitTransaction(TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	return bTransactionOpen && ApplyStagedSettings(EApplyStaged::Commit, OutChangedHandles);
+}
+
+bool UEasySettingsRegistry::ApplyStagedSettings(EApplyStaged Mode, TArray<FSettingHandle>& OutChangedHandles)
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Update);
+
+	// Validate everything before touching GConfig, so a bad value can't leave the transaction half applied.
+	// Settings may also have been released since they were staged.
+	bool bAllValid = true;
+	for (const TPair<FSettingHandle, float>& Staged : StagedFloatSettings)
+	{
+		const int32 TypedIndex = ResolveTypedIndex(Staged.Key, ESettingType::Float);
+		if (TypedIndex == INDEX_NONE || !FloatStorage.IsValid(TypedIndex, Staged.Value))
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("CommitTransaction() found a staged FloatSetting that was released or outside the Min and Max values. Nothing was changed. Handle index was %d"), Staged.Key.GetIndex());
+			bAllValid = false;
+		}
+	}
+	for (const TPair<FSettingHandle, bool>& Staged : StagedOpposingTogglesSettings)
+	{
+		if (ResolveTypedIndex(Staged.Key, ESettingType::OpposingToggles) == INDEX_NONE)
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("CommitTransaction() found a staged OpposingTogglesSetting that was released. Nothing was changed. Handle index was %d"), Staged.Key.GetIndex());
+			bAllValid = false;
+		}
+	}
+	for (const TPair<FSettingHandle, int32>& Staged : StagedEnumSettings)
+	{
+		const int32 TypedIndex = ResolveTypedIndex(Staged.Key, ESettingType::Enum);
+		if (TypedIndex == INDEX_NONE || !EnumStorage.IsValid(TypedIndex, Staged.Value))
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("CommitTransaction() found a staged EnumSetting that was released or not one of its Options. Nothing was changed. Handle index was %d"), Staged.Key.GetIndex());
+			bAllValid = false;
+		}
+	}
+	VisitTupleElements([this, &bAllValid](const auto& Storage)
+	{
+		for (const auto& Staged : Storage.Staged)
+		{
+			const int32 TypedIndex = ResolveTypedIndex(Staged.Key, Storage.Type);
+			if (TypedIndex == INDEX_NONE || !Storage.IsValid(TypedIndex, Staged.Value))
+			{
+				UE_LOG(LogEasySettings, Warning, TEXT("CommitTransaction() found a staged setting that was released or did not pass its validator. Nothing was changed. Handle index was %d"), Staged.Key.GetIndex());
+				bAllValid = false;
+			}
+		}
+	}, GenericStorages);
+
+	if (!bAllValid)
+	{
+		return false;
+	}
+
+	// With a profile active, commits are persisted to the profile and the settings' own values stay in GConfig.
+	const bool bPersist = Mode == EApplyStaged::Commit;
+	const bool bWriteToConfig = bPersist && ActiveProfile.IsNone();
+	const bool bRememberPersisted = Mode == EApplyStaged::Preview;
+
+	// There are only a handful of ini files, so a small inline array is cheaper than a set.
+	TArray<FString, TInlineAllocator<4>> TouchedIniFiles;
+
+	for (const TPair<FSettingHandle, float>& Staged : StagedFloatSettings)
+	{
+		const int32 TypedIndex = ResolveTypedIndex(Staged.Key, ESettingType::Float);
+		if (FloatStorage.Current[TypedIndex] != Staged.Value)
+		{
+			if (bRememberPersisted && !PreviewedFloatSettings.Contains(Staged.Key))
+			{
+				PreviewedFloatSettings.Add(Staged.Key, FloatStorage.Current[TypedIndex]);
+			}
+
+			WriteFloatSetting(Staged.Key, TypedIndex, Staged.Value, bWriteToConfig);
+			if (bPersist)
+			{
+				PersistSetting(Staged.Key, &TouchedIniFiles);
+			}
+			OutChangedHandles.Add(Staged.Key);
+		}
+	}
+	for (const TPair<FSettingHandle, bool>& Staged : StagedOpposingTogglesSettings)
+	{
+		const int32 TypedIndex = ResolveTypedIndex(Staged.Key, ESettingType::OpposingToggles);
+		if (OpposingTogglesStorage.bFirstIsActive[TypedIndex] != Staged.Value)
+		{
+			if (bRememberPersisted && !PreviewedOpposingTogglesSettings.Contains(Staged.Key))
+			{
+				PreviewedOpposingTogglesSettings.Add(Staged.Key, OpposingTogglesStorage.bFirstIsActive[TypedIndex]);
+			}
+
+			WriteOpposingTogglesSetting(Staged.Key, TypedIndex, Staged.Value, bWriteToConfig);
+			if (bPersist)
+			{
+				PersistSetting(Staged.Key, &TouchedIniFiles);
+			}
+			OutChangedHandles.Add(Staged.Key);
+		}
+	}
+	for (const TPair<FSettingHandle, int32>& Staged : StagedEnumSettings)
+	{
+		const int32 TypedIndex = ResolveTypedIndex(Staged.Key, ESettingType::Enum);
+		if (EnumStorage.Current[TypedIndex] != Staged.Value)
+		{
+			if (bRememberPersisted && !PreviewedEnumSettings.Contains(Staged.Key))
+			{
+				PreviewedEnumSettings.Add(Staged.Key, EnumStorage.Current[TypedIndex]);
+			}
+
+			WriteEnumSetting(Staged.Key, TypedIndex, Staged.Value, bWriteToConfig);
+			if (bPersist)
+			{
+				PersistSetting(Staged.Key, &TouchedIniFiles);
+			}
+			OutChangedHandles.Add(Staged.Key);
+		}
+	}
+	VisitTupleElements([this, bPersist, bWriteToConfig, bRememberPersisted, &TouchedIniFiles, &OutChangedHandles](auto& Storage)
+	{
+		using FStorage = std::decay_t<decltype(Storage)>;
+		using FTraits = typename FStorage::FTraits;
+
+		for (const auto& Staged : Storage.Staged)
+		{
+			const int32 TypedIndex = ResolveTypedIndex(Staged.Key, Storage.Type);
+			if (!FTraits::Equals(Storage.Current[TypedIndex], Staged.Value))
+			{
+				if (bRememberPersisted && !Storage.Previewed.Contains(Staged.Key))
+				{
+					Storage.Previewed.Add(Staged.Key, Storage.Current[TypedIndex]);
+				}
+
+				WriteSetting<typename FStorage::SettingType>(Staged.Key, TypedIndex, Staged.Value, bWriteToConfig);
+				if (bPersist)
+				{
+					PersistSetting(Staged.Key, &TouchedIniFiles);
+				}
+				OutChangedHandles.Add(Staged.Key);
+			}
+		}
+	}, GenericStorages);
+
+	// Previews and reverts never leave memory, GConfig still holds the persisted values.
+	if (bPersist)
+	{
+		for (const FString& IniFileName : TouchedIniFiles)
+		{
+			MarkIniDirty(IniFileName);
+		}
+	}
+
+	RollbackTransaction();
+
+	for (const FSettingHandle& Changed : OutChangedHandles)
+	{
+		NotifySettingChanged(Changed);
+	}
+
+	if (Mode == EApplyStaged::Commit && OutChangedHandles.Num() > 0)
+	{
+		SettingsCommittedDelegate.Broadcast(OutChangedHandles);
+	}
+
+	return true;
+}
+
+void UEasySettingsRegistry::RollbackTransaction()
+{
+	StagedFloatSettings.Reset();
+	StagedOpposingTogglesSettings.Reset();
+	StagedEnumSettings.Reset();
+	VisitTupleElements([](auto& Storage) { Storage.Staged.Reset(); }, GenericStorages);
+	bTransactionOpen = false;
+}
+
+bool UEasySettingsRegistry::ApplyPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_ApplyPreset);
+
+	OutChangedHandles.Reset();
+
+	if (!Preset || bTransactionOpen)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("ApplyPreset() called without a preset or while a transaction was open. Nothing was changed."));
+		return false;
+	}
+
+	// Values only compare against what is persisted once the preview is gone, otherwise a previewed value would never be written.
+	TArray<FSettingHandle> RevertedHandles;
+	RevertPreview(RevertedHandles);
+
+	if (!StagePreset(Preset, TEXT("ApplyPreset")))
+	{
+		return false;
+	}
+
+	// The transaction was opened for the preset, so it can't be left open for the caller.
+	if (!ApplyStagedSettings(EApplyStaged::Commit, OutChangedHandles))
+	{
+		RollbackTransaction();
+		return false;
+	}
+	return true;
+}
+
+bool UEasySettingsRegistry::PreviewPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_PreviewPreset);
+
+	OutChangedHandles.Reset();
+
+	if (!Preset || bTransactionOpen)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("PreviewPreset() called without a preset or while a transaction was open. Nothing was changed."));
+		return false;
+	}
+
+	if (!StagePreset(Preset, TEXT("PreviewPreset")))
+	{
+		return false;
+	}
+
+	if (!ApplyStagedSettings(EApplyStaged::Preview, OutChangedHandles))
+	{
+		RollbackTransaction();
+		return false;
+	}
+	return true;
+}
+
+void UEasySettingsRegistry::RevertPreview(TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+
+	if (!IsPreviewingPreset())
+	{
+		return;
+	}
+
+	if (bTransactionOpen)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("RevertPreview() called while a transaction was open. Commit or roll back the open transaction first."));
+		return;
+	}
+
+	// The persisted values were valid when they were replaced and released settings are forgotten, so staging them can't fail.
+	bTransactionOpen = true;
+	StagedFloatSettings = MoveTemp(PreviewedFloatSettings);
+	StagedOpposingTogglesSettings = MoveTemp(PreviewedOpposingTogglesSettings);
+	StagedEnumSettings = MoveTemp(PreviewedEnumSettings);
+	VisitTupleElements([](auto& Storage) { Storage.Staged = MoveTemp(Storage.Previewed); }, GenericStorages);
+
+	ApplyStagedSettings(EApplyStaged::Revert, OutChangedHandles);
+}
+
+bool UEasySettingsRegistry::IsPreviewingPreset() const
+{
+	bool bPreviewing = PreviewedFloatSettings.Num() > 0 || PreviewedOpposingTogglesSettings.Num() > 0 || PreviewedEnumSettings.Num() > 0;
+	VisitTupleElements([&bPreviewing](const auto& Storage) { bPreviewing |= Storage.Previewed.Num() > 0; }, GenericStorages);
+	return bPreviewing;
+}
+
+bool UEasySettingsRegistry::StagePreset(const UEasySettingsPreset* Preset, const TCHAR* FunctionName)
+{
+	BeginTransaction();
+
+	for (const FEasySettingsPresetValue& PresetValue : Preset->Values)
+	{
+		const FString TMapKey = PresetValue.SettingID.GetTMapKey();
+		const FSettingHandle Handle = FindHandle(TMapKey);
+		if (!Handle.IsValid())
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("%s() skipped %s from %s, the setting was not set up."), FunctionName, *TMapKey, *Preset->GetName());
+			continue;
+		}
+
+		if (!StageSettingFromString(Handle, PresetValue.Value))
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("%s() could not parse \"%s\" for %s from %s. Nothing was changed."), FunctionName, *PresetValue.Value, *TMapKey, *Preset->GetName());
+			RollbackTransaction();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool UEasySettingsRegistry::StageSettingFromString(FSettingHandle Handle, const FString& Value)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	switch (Slot->Type)
+	{
+	case ESettingType::Float:
+	{
+		float Parsed;
+		return LexTryParseString(Parsed, *Value) && StageFloatSetting(Handle, Parsed);
+	}
+	case ESettingType::OpposingToggles:
+	{
+		const int32 ParsedToggle = OpposingTogglesStorage.ParseToggle(Slot->TypedIndex, Value);
+		return ParsedToggle != 0 && StageOpposingTogglesSetting(Handle, ParsedToggle == 1);
+	}
+	case ESettingType::Enum:
+	{
+		const int32 ParsedIndex = EnumStorage.ParseOption(Slot->TypedIndex, Value);
+		return ParsedIndex != INDEX_NONE && StageEnumSetting(Handle, ParsedIndex);
+	}
+	default:
+	{
+		bool bStaged = false;
+		VisitTupleElements([this, Slot, Handle, &Value, &bStaged](auto& Storage)
+		{
+			using FStorage = std::decay_t<decltype(Storage)>;
+
+			typename FStorage::ValueType Parsed;
+			if (Storage.Type == Slot->Type && FStorage::FTraits::Parse(Value, Parsed))
+			{
+				bStaged = StageSetting<typename FStorage::SettingType>(Handle, Parsed);
+			}
+		}, GenericStorages);
+		return bStaged;
+	}
+	}
+}
+
+void UEasySettingsRegistry::ForgetPreviewedValue(FSettingHandle Handle)
+{
+	PreviewedFloatSettings.Remove(Handle);
+	PreviewedOpposingTogglesSettings.Remove(Handle);
+	PreviewedEnumSettings.Remove(Handle);
+	VisitTupleElements([Handle](auto& Storage) { Storage.Previewed.Remove(Handle); }, GenericStorages);
+}
+
+bool UEasySettingsRegistry::SetPendingFloatValue(FSettingHandle Handle, float NewPending)
+{
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Float);
+	if (TypedIndex == INDEX_NONE || !FloatStorage.IsValid(TypedIndex, NewPending))
+	{
+		return false;
+	}
+
+	if (FloatStorage.Current[TypedIndex] == NewPending)
+	{
+		PendingFloatSettings.Remove(Handle);
+	}
+	else
+	{
+		PendingFloatSettings.Add(Handle, NewPending);
+	}
+
+	RefreshNonDefault(Handle);
+	return true;
+}
+
+bool UEasySettingsRegistry::SetPendingOpposingTogglesValue(FSettingHandle Handle, bool bActivateFirst)
+{
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::OpposingToggles);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (OpposingTogglesStorage.bFirstIsActive[TypedIndex] == bActivateFirst)
+	{
+		PendingOpposingTogglesSettings.Remove(Handle);
+	}
+	else
+	{
+		PendingOpposingTogglesSettings.Add(Handle, bActivateFirst);
+	}
+
+	RefreshNonDefault(Handle);
+	return true;
+}
+
+bool UEasySettingsRegistry::SetPendingEnumValue(FSettingHandle Handle, int32 NewPending)
+{
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Enum);
+	if (TypedIndex == INDEX_NONE || !EnumStorage.IsValid(TypedIndex, NewPending))
+	{
+		return false;
+	}
+
+	if (EnumStorage.Current[TypedIndex] == NewPending)
+	{
+		PendingEnumSettings.Remove(Handle);
+	}
+	else
+	{
+		PendingEnumSettings.Add(Handle, NewPending);
+	}
+
+	RefreshNonDefault(Handle);
+	return true;
+}
+
+template <typename SettingType>
+bool UEasySettingsRegistry::SetPendingValue(FSettingHandle Handle, const typename TSettingTraits<SettingType>::ValueType& NewPending)
+{
+	using FTraits = TSettingTraits<SettingType>;
+
+	const int32 TypedIndex = ResolveTypedIndex(Handle, FTraits::Type);
+	TSettingStorage<SettingType>& Storage = GetStorage<SettingType>();
+	if (TypedIndex == INDEX_NONE || !Storage.IsValid(TypedIndex, NewPending))
+	{
+		return false;
+	}
+
+	if (FTraits::Equals(Storage.Current[TypedIndex], NewPending))
+	{
+		Storage.Pending.Remove(Handle);
+	}
+	else
+	{
+		Storage.Pending.Add(Handle, NewPending);
+	}
+
+	RefreshNonDefault(Handle);
+	return true;
+}
+
+bool UEasySettingsRegistry::TryGetPendingFloatValue(FSettingHandle Handle, float& OutPending) const
+{
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Float);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const float* Pending = PendingFloatSettings.Find(Handle);
+	OutPending = Pending ? *Pending : FloatStorage.Current[TypedIndex];
+	return true;
+}
+
+bool UEasySettingsRegistry::TryGetPendingOpposingTogglesValue(FSettingHandle Handle, bool& bOutFirstIsActive) const
+{
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::OpposingToggles);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const bool* Pending = PendingOpposingTogglesSettings.Find(Handle);
+	bOutFirstIsActive = Pending ? *Pending : OpposingTogglesStorage.bFirstIsActive[TypedIndex];
+	return true;
+}
+
+bool UEasySettingsRegistry::TryGetPendingEnumValue(FSettingHandle Handle, int32& OutPending) const
+{
+	const int32 TypedIndex = ResolveTypedIndex(Handle, ESettingType::Enum);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const int32* Pending = PendingEnumSettings.Find(Handle);
+	OutPending = Pending ? *Pending : EnumStorage.Current[TypedIndex];
+	return true;
+}
+
+template <typename SettingType>
+bool UEasySettingsRegistry::TryGetPendingValue(FSettingHandle Handle, typename TSettingTraits<SettingType>::ValueType& OutPending) const
+{
+	const int32 TypedIndex = ResolveTypedIndex(Handle, TSettingTraits<SettingType>::Type);
+	if (TypedIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const TSettingStorage<SettingType>& Storage = GetStorage<SettingType>();
+	const typename TSettingTraits<SettingType>::ValueType* Pending = Storage.Pending.Find(Handle);
+	OutPending = Pending ? *Pending : Storage.Current[TypedIndex];
+	return true;
+}
+
+bool UEasySettingsRegistry::HasPendingChange(FSettingHandle Handle) const
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	switch (Slot->Type)
+	{
+	case ESettingType::Float:
+		return PendingFloatSettings.Contains(Handle);
+	case ESettingType::OpposingToggles:
+		return PendingOpposingTogglesSettings.Contains(Handle);
+	case ESettingType::Enum:
+		return PendingEnumSettings.Contains(Handle);
+	default:
+	{
+		bool bPending = false;
+		VisitTupleElements([Slot, Handle, &bPending](const auto& Storage)
+		{
+			bPending |= Storage.Type == Slot->Type && Storage.Pending.Contains(Handle);
+		}, GenericStorages);
+		return bPending;
+	}
+	}
+}
+
+bool UEasySettingsRegistry::HasAnyPendingChanges() const
+{
+	// Pending values equal to the applied value are never kept, so each map only holds real changes.
+	int32 PendingCount = PendingFloatSettings.Num() + PendingOpposingTogglesSettings.Num() + PendingEnumSettings.Num();
+	VisitTupleElements([&PendingCount](const auto& Storage) { PendingCount += Storage.Pending.Num(); }, GenericStorages);
+	return PendingCount > 0;
+}
+
+bool UEasySettingsRegistry::ApplyAll(TArray<FSettingHandle>& OutChangedHandles)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_ApplyAll);
+
+	OutChangedHandles.Reset();
+
+	if (bTransactionOpen)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("ApplyAll() called while a transaction was open. Commit or roll back the open transaction first."));
+		return false;
+	}
+
+	// Pending values were validated when they were set and released settings drop theirs, so the commit can't fail validation.
+	// Writing each value discards it from the pending maps.
+	bTransactionOpen = true;
+	StagedFloatSettings = PendingFloatSettings;
+	StagedOpposingTogglesSettings = PendingOpposingTogglesSettings;
+	StagedEnumSettings = PendingEnumSettings;
+	VisitTupleElements([](auto& Storage) { Storage.Staged = Storage.Pending; }, GenericStorages);
+
+	if (!ApplyStagedSettings(EApplyStaged::Commit, OutChangedHandles))
+	{
+		RollbackTransaction();
+		return false;
+	}
+	return true;
+}
+
+void UEasySettingsRegistry::RevertAll()
+{
+	TArray<FSettingHandle> PendingHandles;
+	PendingFloatSettings.GenerateKeyArray(PendingHandles);
+	for (const TPair<FSettingHandle, bool>& Pending : PendingOpposingTogglesSettings)
+	{
+		PendingHandles.Add(Pending.Key);
+	}
+	for (const TPair<FSettingHandle, int32>& Pending : PendingEnumSettings)
+	{
+		PendingHandles.Add(Pending.Key);
+	}
+	VisitTupleElements([&PendingHandles](const auto& Storage)
+	{
+		for (const auto& Pending : Storage.Pending)
+		{
+			PendingHandles.Add(Pending.Key);
+		}
+	}, GenericStorages);
+
+	for (const FSettingHandle& Handle : PendingHandles)
+	{
+		DiscardPendingValue(Handle);
+	}
+}
+
+void UEasySettingsRegistry::ResetAllToDefault()
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_ResetAllToDefault);
+
+	for (int32 TypedIndex = 0; TypedIndex < FloatStorage.Num(); ++TypedIndex)
+	{
+		const int32 SlotIndex = FloatStorage.SlotIndices[TypedIndex];
+		SetPendingFloatValue(FSettingHandle(SlotIndex, Slots[SlotIndex].Generation), FloatStorage.Default[TypedIndex]);
+	}
+	for (int32 TypedIndex = 0; TypedIndex < OpposingTogglesStorage.Num(); ++TypedIndex)
+	{
+		const int32 SlotIndex = OpposingTogglesStorage.SlotIndices[TypedIndex];
+		SetPendingOpposingTogglesValue(FSettingHandle(SlotIndex, Slots[SlotIndex].Generation), OpposingTogglesStorage.bFirstIsDefault[TypedIndex]);
+	}
+	for (int32 TypedIndex = 0; TypedIndex < EnumStorage.Num(); ++TypedIndex)
+	{
+		const int32 SlotIndex = EnumStorage.SlotIndices[TypedIndex];
+		SetPendingEnumValue(FSettingHandle(SlotIndex, Slots[SlotIndex].Generation), EnumStorage.Default[TypedIndex]);
+	}
+	VisitTupleElements([this](auto& Storage)
+	{
+		using FStorage = std::decay_t<decltype(Storage)>;
+
+		for (int32 TypedIndex = 0; TypedIndex < Storage.Num(); ++TypedIndex)
+		{
+			const int32 SlotIndex = Storage.SlotIndices[TypedIndex];
+			SetPendingValue<typename FStorage::SettingType>(FSettingHandle(SlotIndex, Slots[SlotIndex].Generation), Storage.Default[TypedIndex]);
+		}
+	}, GenericStorages);
+}
+
+bool UEasySettingsRegistry::CreateProfile(FName ProfileName, FName ParentProfile)
+{
+	if (ProfileName.IsNone() || Profiles.Contains(ProfileName) || (!ParentProfile.IsNone() && !Profiles.Contains(ParentProfile)))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("CreateProfile() was called with an empty or existing name, or a parent that doesn't exist. Profile was %s, parent was %s"), *ProfileName.ToString(), *ParentProfile.ToString());
+		return false;
+	}
+
+	FSettingsProfile& Profile = Profiles.Add(ProfileName);
+	Profile.Parent = ParentProfile;
+	Profile.IniFileName = FEasySettingsIniShards::GetIniFileName(EasySettings::GetProfileShard(ProfileName));
+
+	if (const FConfigSection* ConfigSection = EasySettings::FindConfigSection(EasySettings::ProfileSection, Profile.IniFileName))
+	{
+		for (const TPair<FName, FConfigValue>& Override : *ConfigSection)
+		{
+			const FString TMapKey = Override.Key.ToString();
+			if (const FSettingHandle* Handle = HandlesByKey.Find(TMapKey))
+			{
+				Profile.Overlay->Add(*Handle, Override.Value.GetValue());
+			}
+			else
+			{
+				Profile.Unresolved.Add(TMapKey, Override.Value.GetValue());
+			}
+		}
+	}
+
+	return true;
+}
+
+bool UEasySettingsRegistry::CopyProfile(FName SourceProfile, FName NewProfile)
+{
+	const FSettingsProfile* Source = Profiles.Find(SourceProfile);
+	if (!Source || NewProfile.IsNone() || Profiles.Contains(NewProfile))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("CopyProfile() was called with a source that doesn't exist, or an empty or existing name. Source was %s, new profile was %s"), *SourceProfile.ToString(), *NewProfile.ToString());
+		return false;
+	}
+
+	// Copy before adding, as adding may move Source.
+	FSettingsProfile Profile = *Source;
+	Profile.IniFileName = FEasySettingsIniShards::GetIniFileName(EasySettings::GetProfileShard(NewProfile));
+
+	// The overrides stay shared in memory, but the new profile's ini file needs every one of them.
+	GConfig->EmptySection(EasySettings::ProfileSection, Profile.IniFileName);
+	for (const TPair<FSettingHandle, FString>& Override : *Profile.Overlay)
+	{
+		GConfig->SetString(EasySettings::ProfileSection, *SlotMetadata[Override.Key.GetIndex()].ID.GetTMapKey(), *Override.Value, Profile.IniFileName);
+	}
+	for (const TPair<FString, FString>& Override : Profile.Unresolved)
+	{
+		GConfig->SetString(EasySettings::ProfileSection, *Override.Key, *Override.Value, Profile.IniFileName);
+	}
+	MarkIniDirty(Profile.IniFileName);
+
+	Profiles.Add(NewProfile, MoveTemp(Profile));
+	return true;
+}
+
+bool UEasySettingsRegistry::DeleteProfile(FName ProfileName)
+{
+	const FSettingsProfile* Profile = Profiles.Find(ProfileName);
+	if (!Profile || ProfileName == ActiveProfile)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("DeleteProfile() was called with a profile that doesn't exist or is active. Profile was %s"), *ProfileName.ToString());
+		return false;
+	}
+
+	for (const TPair<FName, FSettingsProfile>& Other : Profiles)
+	{
+		if (Other.Value.Parent == ProfileName)
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("DeleteProfile() was called with a profile that %s is layered over. Profile was %s"), *Other.Key.ToString(), *ProfileName.ToString());
+			return false;
+		}
+	}
+
+	GConfig->EmptySection(EasySettings::ProfileSection, Profile->IniFileName);
+	MarkIniDirty(Profile->IniFileName);
+	Profiles.Remove(ProfileName);
+	return true;
+}
+
+bool UEasySettingsRegistry::SetActiveProfile(FName ProfileName, TArray<FSettingHandle>& OutChangedHandles)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_SetActiveProfile);
+
+	OutChangedHandles.Reset();
+
+	if (!ProfileName.IsNone() && !Profiles.Contains(ProfileName))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("SetActiveProfile() was called with a profile that doesn't exist. Profile was %s"), *ProfileName.ToString());
+		return false;
+	}
+
+	if (bTransactionOpen)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("SetActiveProfile() called while a transaction was open. Commit or roll back the open transaction first."));
+		return false;
+	}
+
+	if (ProfileName == ActiveProfile)
+	{
+		return true;
+	}
+
+	// The values a preview would revert to belong to the outgoing profile.
+	TArray<FSettingHandle> RevertedHandles;
+	RevertPreview(RevertedHandles);
+
+	ActiveProfile = ProfileName;
+
+	// A single pass over the setting table. Nothing is written, the values are already persisted in the profiles' or the settings' own ini files.
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		const FSettingHandle Handle(SlotIndex, Slots[SlotIndex].Generation);
+		if (Slots[SlotIndex].IsPersisted() && ResolveProfileValue(Handle))
+		{
+			OutChangedHandles.Add(Handle);
+		}
+	}
+
+	// Notified the same as a committed transaction.
+	for (const FSettingHandle& Changed : OutChangedHandles)
+	{
+		NotifySettingChanged(Changed);
+	}
+
+	if (OutChangedHandles.Num() > 0)
+	{
+		SettingsCommittedDelegate.Broadcast(OutChangedHandles);
+	}
+
+	UE_LOG(LogEasySettings, Log, TEXT("Switched to settings profile %s, %d settings changed."), *ProfileName.ToString(), OutChangedHandles.Num());
+	return true;
+}
+
+void UEasySettingsRegistry::WriteProfileValue(FSettingHandle Handle)
+{
+	FSettingsProfile& Profile = Profiles.FindChecked(ActiveProfile);
+	FString Value = GetValueString(Handle.GetIndex());
+	GConfig->SetString(EasySettings::ProfileSection, *SlotMetadata[Handle.GetIndex()].ID.GetTMapKey(), *Value, Profile.IniFileName);
+	Profile.GetMutableOverlay().Add(Handle, MoveTemp(Value));
+
+	// The written value is now the persisted one.
+	ForgetPreviewedValue(Handle);
+}
+
+bool UEasySettingsRegistry::FindProfileValue(FSettingHandle Handle, FString& OutValue) const
+{
+	if (ActiveProfile.IsNone())
+	{
+		const FSettingBase& ID = SlotMetadata[Handle.GetIndex()].ID;
+		if (const FConfigValue* ConfigValue = EasySettings::FindConfigValue(EasySettings::FindConfigSection(ID.Section, ID.GetIniFileName()), ID.Key))
+		{
+			OutValue = ConfigValue->GetValue();
+			return true;
+		}
+		return false;
+	}
+
+	// Parents were checked to exist when each profile was created, and can't be deleted while layered over.
+	for (const FSettingsProfile* Profile = &Profiles.FindChecked(ActiveProfile); Profile; Profile = Profile->Parent.IsNone() ? nullptr : &Profiles.FindChecked(Profile->Parent))
+	{
+		if (const FString* Value = Profile->Overlay->Find(Handle))
+		{
+			OutValue = *Value;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UEasySettingsRegistry::ResolveProfileValue(FSettingHandle Handle)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	// Anything missing or invalid falls back to the Default, the same as Setup.
+	FString Value;
+	const bool bFound = FindProfileValue(Handle, Value);
+	const int32 TypedIndex = Slot->TypedIndex;
+	switch (Slot->Type)
+	{
+	case ESettingType::Float:
+	{
+		float Resolved;
+		if (!bFound || !LexTryParseString(Resolved, *Value) || !FloatStorage.IsValid(TypedIndex, Resolved))
+		{
+			Resolved = FloatStorage.Default[TypedIndex];
+		}
+		if (FloatStorage.Current[TypedIndex] == Resolved)
+		{
+			return false;
+		}
+		WriteFloatSetting(Handle, TypedIndex, Resolved, false);
+		return true;
+	}
+	case ESettingType::OpposingToggles:
+	{
+		const int32 ParsedToggle = bFound ? OpposingTogglesStorage.ParseToggle(TypedIndex, Value) : 0;
+		const bool bResolved = ParsedToggle != 0 ? ParsedToggle == 1 : OpposingTogglesStorage.bFirstIsDefault[TypedIndex];
+		if (OpposingTogglesStorage.bFirstIsActive[TypedIndex] == bResolved)
+		{
+			return false;
+		}
+		WriteOpposingTogglesSetting(Handle, TypedIndex, bResolved, false);
+		return true;
+	}
+	case ESettingType::Enum:
+	{
+		int32 Resolved = bFound ? EnumStorage.ParseOption(TypedIndex, Value) : INDEX_NONE;
+		if (!EnumStorage.IsValid(TypedIndex, Resolved))
+		{
+			Resolved = EnumStorage.Default[TypedIndex];
+		}
+		if (EnumStorage.Current[TypedIndex] == Resolved)
+		{
+			return false;
+		}
+		WriteEnumSetting(Handle, TypedIndex, Resolved, false);
+		return true;
+	}
+	default:
+	{
+		bool bChanged = false;
+		VisitTupleElements([this, Slot, Handle, TypedIndex, bFound, &Value, &bChanged](auto& Storage)
+		{
+			using FStorage = std::decay_t<decltype(Storage)>;
+			using FTraits = typename FStorage::FTraits;
+
+			if (Storage.Type != Slot->Type)
+			{
+				return;
+			}
+
+			typename FStorage::ValueType Resolved;
+			if (!bFound || !FTraits::Parse(Value, Resolved) || !Storage.IsValid(TypedIndex, Resolved))
+			{
+				Resolved = Storage.Default[TypedIndex];
+			}
+			if (!FTraits::Equals(Storage.Current[TypedIndex], Resolved))
+			{
+				WriteSetting<typename FStorage::SettingType>(Handle, TypedIndex, Resolved, false);
+				bChanged = true;
+			}
+		}, GenericStorages);
+		return bChanged;
+	}
+	}
+}
+
+void UEasySettingsRegistry::RefreshNonDefault(FSettingHandle Handle)
+{
+	FSettingSlot& Slot = Slots[Handle.GetIndex()];
+
+	bool bNonDefault = false;
+	switch (Slot.Type)
+	{
+	case ESettingType::Float:
+	{
+		const float* Pending = PendingFloatSettings.Find(Handle);
+		bNonDefault = (Pending ? *Pending : FloatStorage.Current[Slot.TypedIndex]) != FloatStorage.Default[Slot.TypedIndex];
+		break;
+	}
+	case ESettingType::OpposingToggles:
+	{
+		const bool* Pending = PendingOpposingTogglesSettings.Find(Handle);
+		bNonDefault = (Pending ? *Pending : OpposingTogglesStorage.bFirstIsActive[Slot.TypedIndex]) != OpposingTogglesStorage.bFirstIsDefault[Slot.TypedIndex];
+		break;
+	}
+	case ESettingType::Enum:
+	{
+		const int32* Pending = PendingEnumSettings.Find(Handle);
+		bNonDefault = (Pending ? *Pending : EnumStorage.Current[Slot.TypedIndex]) != EnumStorage.Default[Slot.TypedIndex];
+		break;
+	}
+	default:
+		VisitTupleElements([&Slot, Handle, &bNonDefault](const auto& Storage)
+		{
+			using FStorage = std::decay_t<decltype(Storage)>;
+
+			if (Storage.Type == Slot.Type)
+			{
+				const typename FStorage::ValueType* Pending = Storage.Pending.Find(Handle);
+				bNonDefault = !FStorage::FTraits::Equals(Pending ? *Pending : Storage.Current[Slot.TypedIndex], Storage.Default[Slot.TypedIndex]);
+			}
+		}, GenericStorages);
+		break;
+	}
+
+	if (Slot.bNonDefault != bNonDefault)
+	{
+		Slot.bNonDefault = bNonDefault;
+		NonDefaultCount += bNonDefault ? 1 : -1;
+	}
+}
+
+void UEasySettingsRegistry::DiscardPendingValue(FSettingHandle Handle)
+{
+	PendingFloatSettings.Remove(Handle);
+	PendingOpposingTogglesSettings.Remove(Handle);
+	PendingEnumSettings.Remove(Handle);
+	VisitTupleElements([Handle](auto& Storage) { Storage.Pending.Remove(Handle); }, GenericStorages);
+
+	RefreshNonDefault(Handle);
+}
+
+void UEasySettingsRegistry::ReloadFromConfig(EIniFile IniFile, TArray<FSettingHandle>& OutChangedHandles)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_ReloadFromConfig);
+
+	// Sharded settings are spread over one file per shard.
+	TSet<FString> IniFileNames;
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex].IsPersisted() && SlotMetadata[SlotIndex].ID.IniFile == IniFile)
+		{
+			IniFileNames.Add(SlotMetadata[SlotIndex].ID.GetIniFileName());
+		}
+	}
+	for (const FString& IniFileName : IniFileNames)
+	{
+		Snapshot.InvalidateIniFile(IniFileName);
+	}
+
+	ReloadSettings([IniFile](const FSettingBase& ID) { return ID.IniFile == IniFile; }, OutChangedHandles);
+}
+
+void UEasySettingsRegistry::ReloadSettings(TFunctionRef<bool(const FSettingBase& ID)> ShouldReload, TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+
+	// The settings' own values aren't shown while a profile is active. GConfig has the reloaded values, so SetActiveProfile picks them up on the way back.
+	if (!ActiveProfile.IsNone())
+	{
+		return;
+	}
+
+	// Read every float in the file straight into storage, keeping the old values around to diff against.
+	// Same as the toggles below, a missing or non numeric value keeps the current value, and the bulk validation puts it back for one outside Min and Max.
+	const TArray<float> PreviousFloats = FloatStorage.Current;
+	for (int32 TypedIndex = 0; TypedIndex < FloatStorage.Num(); ++TypedIndex)
+	{
+		const FSettingBase& ID = SlotMetadata[FloatStorage.SlotIndices[TypedIndex]].ID;
+		if (!ShouldReload(ID))
+		{
+			continue;
+		}
+
+		// Atof reads a typo as 0, which would pass validation whenever 0 is in range.
+		const FConfigValue* ConfigValue = EasySettings::FindConfigValue(EasySettings::FindConfigSection(ID.Section, ID.GetIniFileName()), ID.Key);
+		if (!ConfigValue || !FCString::IsNumeric(*ConfigValue->GetValue()))
+		{
+			continue;
+		}
+
+		FloatStorage.Current[TypedIndex] = FCString::Atof(*ConfigValue->GetValue());
+	}
+
+	FloatStorage.RestoreInvalid(PreviousFloats);
+
+	for (int32 TypedIndex = 0; TypedIndex < FloatStorage.Num(); ++TypedIndex)
+	{
+		if (FloatStorage.Current[TypedIndex] != PreviousFloats[TypedIndex])
+		{
+			const int32 SlotIndex = FloatStorage.SlotIndices[TypedIndex];
+			const FSettingHandle Handle(SlotIndex, Slots[SlotIndex].Generation);
+			ValueTable->PublishFloat(Handle, FloatStorage.Current[TypedIndex]);
+			OutChangedHandles.Add(Handle);
+		}
+	}
+
+	for (int32 TypedIndex = 0; TypedIndex < OpposingTogglesStorage.Num(); ++TypedIndex)
+	{
+		const int32 SlotIndex = OpposingTogglesStorage.SlotIndices[TypedIndex];
+		const FSettingBase& ID = SlotMetadata[SlotIndex].ID;
+		if (!ShouldReload(ID))
+		{
+			continue;
+		}
+
+		// An invalid or missing toggle keeps its current value, it will be rewritten on the next update.
+		const FConfigValue* ConfigValue = EasySettings::FindConfigValue(EasySettings::FindConfigSection(ID.Section, ID.GetIniFileName()), ID.Key);
+		const int32 ParsedToggle = ConfigValue ? OpposingTogglesStorage.ParseToggle(TypedIndex, ConfigValue->GetValue()) : 0;
+		if (ParsedToggle == 0)
+		{
+			continue;
+		}
+
+		const bool bFirstIsActive = ParsedToggle == 1;
+
+		if (OpposingTogglesStorage.bFirstIsActive[TypedIndex] != bFirstIsActive)
+		{
+			OpposingTogglesStorage.bFirstIsActive[TypedIndex] = bFirstIsActive;
+
+			const FSettingHandle Handle(SlotIndex, Slots[SlotIndex].Generation);
+			ValueTable->PublishBool(Handle, bFirstIsActive);
+			OutChangedHandles.Add(Handle);
+		}
+	}
+
+	for (int32 TypedIndex = 0; TypedIndex < EnumStorage.Num(); ++TypedIndex)
+	{
+		const int32 SlotIndex = EnumStorage.SlotIndices[TypedIndex];
+		const FSettingBase& ID = SlotMetadata[SlotIndex].ID;
+		if (!ShouldReload(ID))
+		{
+			continue;
+		}
+
+		// Same as the toggles, an invalid or missing option keeps its current value.
+		const FConfigValue* ConfigValue = EasySettings::FindConfigValue(EasySettings::FindConfigSection(ID.Section, ID.GetIniFileName()), ID.Key);
+		const int32 ReceivedIndex = ConfigValue ? EnumStorage.ParseOption(TypedIndex, ConfigValue->GetValue()) : INDEX_NONE;
+		if (ReceivedIndex == INDEX_NONE || ReceivedIndex == EnumStorage.Current[TypedIndex])
+		{
+			continue;
+		}
+
+		EnumStorage.Current[TypedIndex] = ReceivedIndex;
+
+		const FSettingHandle Handle(SlotIndex, Slots[SlotIndex].Generation);
+		ValueTable->PublishInt(Handle, ReceivedIndex);
+		OutChangedHandles.Add(Handle);
+	}
+
+	VisitTupleElements([this, &ShouldReload, &OutChangedHandles](auto& Storage)
+	{
+		using FTraits = typename std::decay_t<decltype(Storage)>::FTraits;
+
+		for (int32 TypedIndex = 0; TypedIndex < Storage.Num(); ++TypedIndex)
+		{
+			const int32 SlotIndex = Storage.SlotIndices[TypedIndex];
+			const FSettingBase& ID = SlotMetadata[SlotIndex].ID;
+			if (!ShouldReload(ID))
+			{
+				continue;
+			}
+
+			// Same as the toggles, a missing value or one the validator rejects keeps the current value.
+			const FConfigValue* ConfigValue = EasySettings::FindConfigValue(EasySettings::FindConfigSection(ID.Section, ID.GetIniFileName()), ID.Key);
+			typename FTraits::ValueType Received = Storage.Current[TypedIndex];
+			if (!ConfigValue || !FTraits::Parse(ConfigValue->GetValue(), Received) || !Storage.IsValid(TypedIndex, Received) || FTraits::Equals(Received, Storage.Current[TypedIndex]))
+			{
+				continue;
+			}
+
+			Storage.Current[TypedIndex] = Received;
+
+			const FSettingHandle Handle(SlotIndex, Slots[SlotIndex].Generation);
+			if constexpr (FTraits::bHasValueBits)
+			{
+				ValueTable->PublishInt(Handle, int32(FTraits::ToBits(Received)));
+			}
+			OutChangedHandles.Add(Handle);
+		}
+	}, GenericStorages);
+
+	// Only notify once storage is consistent, listeners may read other settings from the same file.
+	for (const FSettingHandle& Changed : OutChangedHandles)
+	{
+		// The edit on disk is now the persisted value, a later revert must not undo it, and neither must an older journal record on the next boot.
+		ForgetPreviewedValue(Changed);
+		DiscardPendingValue(Changed);
+		if (Journal.Contains(SlotMetadata[Changed.GetIndex()].KeyHash))
+		{
+			AppendToJournal(Changed);
+		}
+		WriteSettingBindings(Changed);
+		MarkDerivedDirty(Changed);
+		DispatchSettingChanged(Changed);
+	}
+}
+
+bool UEasySettingsRegistry::TickIniWatcher(float DeltaTime)
+{
+	IniWatcher.TryFinishPoll([this](const FString& IniFileName, const TMap<FString, FConfigSection>& Sections)
+	{
+		ApplyExternalIniChanges(IniFileName, Sections);
+	});
+
+	if (!IniWatcher.IsPolling())
+	{
+		// Only the sections holding registered settings are worth parsing, rebuilt whenever a setting is registered or released.
+		if (bWatchedSectionsStale)
+		{
+			WatchedSections.Reset();
+			for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+			{
+				if (Slots[SlotIndex].IsPersisted())
+				{
+					const FSettingBase& ID = SlotMetadata[SlotIndex].ID;
+					WatchedSections.FindOrAdd(ID.GetIniFileName()).Add(ID.Section);
+				}
+			}
+
+			// Files are only watched once they hold a setting, which also picks up shards as they are first used.
+			for (const TPair<FString, TSet<FString>>& Sections : WatchedSections)
+			{
+				IniWatcher.Watch(Sections.Key);
+			}
+			bWatchedSectionsStale = false;
+		}
+
+		if (WatchedSections.Num() > 0)
+		{
+			IniWatcher.BeginPoll(TMap<FString, TSet<FString>>(WatchedSections));
+		}
+	}
+
+	// Keep polling for as long as the registry lives.
+	return true;
+}
+
+void UEasySettingsRegistry::ApplyExternalIniChanges(const FString& IniFileName, const TMap<FString, FConfigSection>& Sections)
+{
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*IniFileName);
+
+	FConfigFile* ConfigFile = GConfig->FindConfigFile(IniFileName);
+	if (!ConfigFile)
+	{
+		return;
+	}
+
+	// Copy over only the values that differ, so a section nobody edited doesn't cause a reload.
+	// The file on disk already holds these values, so GConfig isn't marked dirty and nothing is written back.
+	TSet<FString> ChangedSections;
+	for (const TPair<FString, FConfigSection>& ParsedSection : Sections)
+	{
+		FConfigSection* ConfigSection = ConfigFile->FindOrAddSection(ParsedSection.Key);
+		bool bSectionChanged = false;
+
+		for (const TPair<FName, FConfigValue>& ParsedValue : ParsedSection.Value)
+		{
+			// Array entries can't be matched up one to one, and settings never use them.
+			if (ParsedSection.Value.Num(ParsedValue.Key) > 1)
+			{
+				continue;
+			}
+
+			FConfigValue* ConfigValue = ConfigSection->Find(ParsedValue.Key);
+			if (!ConfigValue)
+			{
+				ConfigSection->Add(ParsedValue.Key, ParsedValue.Value);
+				bSectionChanged = true;
+			}
+			else if (!ConfigValue->GetValue().Equals(ParsedValue.Value.GetValue(), ESearchCase::CaseSensitive))
+			{
+				*ConfigValue = ParsedValue.Value;
+				bSectionChanged = true;
+			}
+		}
+
+		if (bSectionChanged)
+		{
+			ChangedSections.Add(ParsedSection.Key);
+		}
+	}
+
+	if (ChangedSections.Num() == 0)
+	{
+		return;
+	}
+
+	Snapshot.InvalidateIniFile(IniFileName);
+
+	TArray<FSettingHandle> ChangedHandles;
+	ReloadSettings([&IniFileName, &ChangedSections](const FSettingBase& ID)
+	{
+		return ChangedSections.Contains(ID.Section) && ID.GetIniFileName() == IniFileName;
+	}, ChangedHandles);
+	UE_LOG(LogEasySettings, Log, TEXT("Applied outside edits to %d sections of %s, %d settings changed."), ChangedSections.Num(), *IniFileName, ChangedHandles.Num());
+}
+
+void UEasySettingsRegistry::MarkIniDirty(const FString& IniFileName)
+{
+	++PersistenceStats.FlushesRequested;
+
+	// GConfig now holds values the snapshot doesn't, e.g. for a setting that is released and setup again.
+	Snapshot.InvalidateIniFile(IniFileName);
+
+	if (!bWriteBehindPersistence && !bDeferIniFlushes)
+	{
+		FlushIniFile(IniFileName);
+		return;
+	}
+
+	bool bAlreadyDirty = false;
+	DirtyIniFiles.Add(IniFileName, &bAlreadyDirty);
+	if (bAlreadyDirty)
+	{
+		++PersistenceStats.FlushesCoalesced;
+	}
+
+	if (!WriteBehindTickerHandle.IsValid())
+	{
+		WriteBehindTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEasySettingsRegistry::TickWriteBehind), WriteBehindFlushInterval);
+	}
+}
+
+void UEasySettingsRegistry::FlushDirtyIniFiles()
+{
+	if (WriteBehindTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(WriteBehindTickerHandle);
+		WriteBehindTickerHandle.Reset();
+	}
+
+	for (const FString& IniFileName : DirtyIniFiles)
+	{
+		FlushIniFile(IniFileName);
+	}
+	DirtyIniFiles.Reset();
+}
+
+void UEasySettingsRegistry::FlushIniFile(const FString& IniFileName)
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Flush);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*IniFileName);
+
+	GConfig->Flush(false, IniFileName);
+	IniWatcher.NotifyWritten(IniFileName);
+	++PersistenceStats.FlushesPerformed;
+	INC_DWORD_STAT(STAT_EasySettings_Flushes);
+
+#if STATS || EASYSETTINGS_TRACE_ENABLED
+	// GConfig rewrites the whole file, so its size is what the flush cost on disk. Reading it is another trip to the disk, so only builds that report it pay for it.
+	const int64 FileSize = IFileManager::Get().FileSize(*FEasySettingsSnapshot::GetIniFilePathOnDisk(IniFileName));
+	if (FileSize > 0)
+	{
+		PersistenceStats.FlushedFileBytes += FileSize;
+		INC_DWORD_STAT_BY(STAT_EasySettings_BytesFlushed, FileSize);
+		EASYSETTINGS_TRACE_BYTES_FLUSHED(FileSize);
+		UE_LOG(LogEasySettings, Verbose, TEXT("Flushed %s, %lld bytes on disk"), *IniFileName, FileSize);
+	}
+#endif
+}
+
+bool UEasySettingsRegistry::TickWriteBehind(float DeltaTime)
+{
+	// GConfig is not thread safe, so the flush stays on the game thread. Deferring it means a slider drag costs one write per interval instead of one per value.
+	WriteBehindTickerHandle.Reset();
+	FlushDirtyIniFiles();
+
+	// Stay unregistered until something else is marked dirty.
+	return false;
+}
+
+FEasySettingsMemoryStats UEasySettingsRegistry::GetMemoryStats() const
+{
+	FEasySettingsMemoryStats Stats;
+	Stats.NumSettings = Slots.Num() - FreeSlots.Num();
+	Stats.NumOptionSets = OptionSetTable.Num();
+
+	SIZE_T MetadataBytes = SlotMetadata.GetAllocatedSize() + HandlesByKey.GetAllocatedSize();
+	for (const FSettingSlotMetadata& Metadata : SlotMetadata)
+	{
+		MetadataBytes += Metadata.ID.Section.GetAllocatedSize() + Metadata.ID.Key.GetAllocatedSize();
+	}
+
+	// Estimated from sizes, as the copies don't exist. Without sharing, every slot kept its own copy of the TMapKey next to the one in HandlesByKey, where KeyHash is now.
+	SIZE_T KeyCopyBytes = (sizeof(FString) - sizeof(uint64)) * SlotMetadata.Max();
+	for (const TPair<FString, FSettingHandle>& Entry : HandlesByKey)
+	{
+		MetadataBytes += Entry.Key.GetAllocatedSize();
+		KeyCopyBytes += Entry.Key.GetAllocatedSize();
+	}
+
+	// And every toggles setting its four names, every enum setting its options, tokens and lookup table.
+	SIZE_T UnsharedOptionBytes = 0;
+	for (const FEasySettingsOptionSet* Toggles : OpposingTogglesStorage.Toggles)
+	{
+		UnsharedOptionBytes += 4 * sizeof(FString) + Toggles->GetNamesAllocatedSize();
+	}
+	for (const FEasySettingsOptionSet* Options : EnumStorage.OptionSets)
+	{
+		UnsharedOptionBytes += 2 * sizeof(TArray<FString>) + sizeof(TMap<FString, int32>) + Options->GetAllocatedSize();
+	}
+
+	const SIZE_T SharedOptionBytes = OptionSetTable.GetAllocatedSize() + OpposingTogglesStorage.Toggles.GetAllocatedSize() + EnumStorage.OptionSets.GetAllocatedSize();
+
+	Stats.NameBytes = int64(MetadataBytes + SharedOptionBytes);
+	Stats.NameBytesWithoutSharing = int64(MetadataBytes + KeyCopyBytes + UnsharedOptionBytes);
+	return Stats;
+}
+
+void UEasySettingsRegistry::PersistSetting(FSettingHandle Handle, TArray<FString, TInlineAllocator<4>>* OutTouchedIniFiles)
+{
+	FString IniFileName;
+	if (!ActiveProfile.IsNone())
+	{
+		WriteProfileValue(Handle);
+		IniFileName = Profiles.FindChecked(ActiveProfile).IniFileName;
+	}
+	else if (AppendToJournal(Handle))
+	{
+		return;
+	}
+	else
+	{
+		IniFileName = SlotMetadata[Handle.GetIndex()].ID.GetIniFileName();
+	}
+
+	if (OutTouchedIniFiles)
+	{
+		OutTouchedIniFiles->AddUnique(IniFileName);
+	}
+	else
+	{
+		MarkIniDirty(IniFileName);
+	}
+}
+
+bool UEasySettingsRegistry::AppendToJournal(FSettingHandle Handle)
+{
+	if (!Journal.IsOpen())
+	{
+		return false;
+	}
+
+	const FSettingSlot& Slot = Slots[Handle.GetIndex()];
+	uint32 ValueBits = 0;
+	switch (Slot.Type)
+	{
+	case ESettingType::Float:
+		FMemory::Memcpy(&ValueBits, &FloatStorage.Current[Slot.TypedIndex], sizeof(ValueBits));
+		break;
+	case ESettingType::OpposingToggles:
+		ValueBits = OpposingTogglesStorage.bFirstIsActive[Slot.TypedIndex] ? 1 : 0;
+		break;
+	case ESettingType::Enum:
+		ValueBits = uint32(EnumStorage.Current[Slot.TypedIndex]);
+		break;
+	default:
+	{
+		// Values that don't fit in 32 bits always go through the ini.
+		bool bFits = false;
+		VisitTupleElements([&Slot, &ValueBits, &bFits](const auto& Storage)
+		{
+			using FTraits = typename std::decay_t<decltype(Storage)>::FTraits;
+
+			if constexpr (FTraits::bHasValueBits)
+			{
+				if (Storage.Type == Slot.Type)
+				{
+					ValueBits = FTraits::ToBits(Storage.Current[Slot.TypedIndex]);
+					bFits = true;
+				}
+			}
+		}, GenericStorages);
+
+		if (!bFits)
+		{
+			return false;
+		}
+		break;
+	}
+	}
+
+	// GConfig already holds the value, it reaches the ini file when the journal is compacted.
+	Journal.Append(SlotMetadata[Handle.GetIndex()].KeyHash, Slot.Type, ValueBits);
+
+	if (Journal.GetNumAppended() >= JournalCompactionThreshold && !JournalTickerHandle.IsValid())
+	{
+		JournalTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEasySettingsRegistry::TickJournal));
+	}
+	return true;
+}
+
+FString UEasySettingsRegistry::GetValueString(int32 SlotIndex) const
+{
+	const FSettingSlot& Slot = Slots[SlotIndex];
+	switch (Slot.Type)
+	{
+	case ESettingType::Float:
+		return LexToString(FloatStorage.Current[Slot.TypedIndex]);
+	case ESettingType::OpposingToggles:
+		return OpposingTogglesStorage.GetToken(Slot.TypedIndex, OpposingTogglesStorage.bFirstIsActive[Slot.TypedIndex]);
+	case ESettingType::Enum:
+		return EnumStorage.GetToken(Slot.TypedIndex, EnumStorage.Current[Slot.TypedIndex]);
+	default:
+	{
+		FString Value;
+		VisitTupleElements([&Slot, &Value](const auto& Storage)
+		{
+			using FTraits = typename std::decay_t<decltype(Storage)>::FTraits;
+
+			if (Storage.Type == Slot.Type)
+			{
+				Value = FTraits::ToString(Storage.Current[Slot.TypedIndex]);
+			}
+		}, GenericStorages);
+		return Value;
+	}
+	}
+}
+
+void UEasySettingsRegistry::WriteCurrentToConfig(int32 SlotIndex)
+{
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_ConfigWrite);
+
+	const FSettingBase& ID = SlotMetadata[SlotIndex].ID;
+	GConfig->SetString(*ID.Section, *ID.Key, *GetValueString(SlotIndex), ID.GetIniFileName());
+}
+
+void UEasySettingsRegistry::CompactJournal()
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_CompactJournal);
+
+	if (!Journal.IsOpen() || Journal.IsCompacting())
+	{
+		return;
+	}
+
+	// GConfig already holds every journaled value of a registered setting, they only need to be flushed.
+	// Records of settings that aren't registered this session are kept as they are.
+	TArray<uint64> FoldedKeys;
+	TArray<FString> TouchedIniFiles;
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		const FSettingSlotMetadata& Metadata = SlotMetadata[SlotIndex];
+		if (!Slots[SlotIndex].IsPersisted() || !Journal.Contains(Metadata.KeyHash))
+		{
+			continue;
+		}
+
+		FoldedKeys.Add(Metadata.KeyHash);
+		TouchedIniFiles.AddUnique(Metadata.ID.GetIniFileName());
+	}
+
+	// The records are only dropped once their values are on disk. GConfig is not thread safe, so this part stays on the game thread.
+	for (const FString& IniFileName : TouchedIniFiles)
+	{
+		++PersistenceStats.FlushesRequested;
+		Snapshot.InvalidateIniFile(IniFileName);
+		FlushIniFile(IniFileName);
+		DirtyIniFiles.Remove(IniFileName);
+	}
+
+	Journal.BeginCompaction(FoldedKeys);
+	UE_LOG(LogEasySettings, Verbose, TEXT("Folded %d journaled settings into %d ini files."), FoldedKeys.Num(), TouchedIniFiles.Num());
+}
+
+bool UEasySettingsRegistry::TickJournal(float DeltaTime)
+{
+	if (!Journal.IsCompacting())
+	{
+		CompactJournal();
+	}
+
+	// Keep ticking until the worker has replaced the file, so the records appended in the meantime are written out.
+	if (!Journal.TryFinishCompaction())
+	{
+		return true;
+	}
+
+	// If the file couldn't be reopened, values journaled since are only in GConfig, so flush every file they may live in.
+	if (!Journal.IsOpen())
+	{
+		TSet<FString> IniFileNames;
+		for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+		{
+			if (Slots[SlotIndex].IsPersisted())
+			{
+				IniFileNames.Add(SlotMetadata[SlotIndex].ID.GetIniFileName());
+			}
+		}
+		for (const FString& IniFileName : IniFileNames)
+		{
+			MarkIniDirty(IniFileName);
+		}
+	}
+
+	JournalTickerHandle.Reset();
+	return false;
+}
+
+bool UEasySettingsRegistry::SetNotifyOnEveryChange(FSettingHandle Handle, bool bEveryChange)
+{
+	FSettingSlot* Slot = ResolveMutableSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	Slot->bNotifyOnEveryChange = bEveryChange;
+	return true;
+}
+
+void UEasySettingsRegistry::FlushPendingNotifications()
+{
+	if (PendingNotifications.Num() == 0)
+	{
+		return;
+	}
+
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsRegistry_FlushPendingNotifications);
+
+	// Listeners may update settings again, those changes are queued for the next end of frame.
+	const TArray<FSettingHandle> Notifications = MoveTemp(PendingNotifications);
+	PendingNotifications.Reset();
+
+	for (const FSettingHandle& Handle : Notifications)
+	{
+		if (FSettingSlot* Slot = ResolveMutableSlot(Handle))
+		{
+			Slot->bNotificationPending = false;
+		}
+	}
+
+	// Storage already holds the final value, so listeners only ever see that.
+	for (const FSettingHandle& Handle : Notifications)
+	{
+		NotifySettingChanged(Handle);
+		BroadcastGlobalDelegate(Handle);
+	}
+}
+
+void UEasySettingsRegistry::DispatchSettingChanged(FSettingHandle Handle)
+{
+	FSettingSlot* Slot = ResolveMutableSlot(Handle);
+	if (!Slot)
+	{
+		return;
+	}
+
+	if (!bCoalesceChangeNotifications || Slot->bNotifyOnEveryChange)
+	{
+		NotifySettingChanged(Handle);
+		BroadcastGlobalDelegate(Handle);
+		return;
+	}
+
+	// One entry per setting, however many times it changes this frame.
+	if (Slot->bNotificationPending)
+	{
+		INC_DWORD_STAT(STAT_EasySettings_NotificationsCoalesced);
+		return;
+	}
+
+	Slot->bNotificationPending = true;
+	PendingNotifications.Add(Handle);
+}
+
+void UEasySettingsRegistry::NotifySettingChanged(FSettingHandle Handle)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot || !Slot->Listeners.IsValid())
+	{
+		return;
+	}
+
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Broadcast);
+	EASYSETTINGS_TRACE_SCOPE_TEXT(*GetTraceName(Handle));
+
+	// Hold our own reference, listeners may release the setting or register new ones while being notified.
+	const TSharedRef<FSettingListeners> Listeners = Slot->Listeners.ToSharedRef();
+	INC_DWORD_STAT_BY(STAT_EasySettings_ListenersNotified, Listeners->NumNative + Listeners->Dynamic.Num());
+	Listeners->Native.Broadcast(Handle);
+
+	// Walk backwards so listeners can unbind themselves without skipping anyone.
+	for (int32 Index = Listeners->Dynamic.Num() - 1; Index >= 0; --Index)
+	{
+		if (Listeners->Dynamic.IsValidIndex(Index))
+		{
+			const FSettingChangedDynamicSignature Listener = Listeners->Dynamic[Index];
+			Listener.ExecuteIfBound(Handle);
+		}
+	}
+}
+
+bool UEasySettingsRegistry::AddSettingBinding(FSettingHandle Handle, FSettingBinding&& Binding)
+{
+	FSettingSlot* Slot = ResolveMutableSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	if (!Slot->Listeners.IsValid())
+	{
+		Slot->Listeners = MakeShared<FSettingListeners>();
+	}
+
+	// Binding the same member twice would only write it twice.
+	const bool bAlreadyBound = Slot->Listeners->Bindings.ContainsByPredicate([&Binding](const FSettingBinding& Existing)
+	{
+		return Existing.Address == Binding.Address && Existing.Owner == Binding.Owner;
+	});
+
+	if (!bAlreadyBound)
+	{
+		Slot->Listeners->Bindings.Add(MoveTemp(Binding));
+	}
+
+	WriteSettingBindings(Handle);
+	return true;
+}
+
+void UEasySettingsRegistry::WriteSettingBindings(FSettingHandle Handle)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot || !Slot->Listeners.IsValid() || Slot->Listeners->Bindings.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FSettingBinding>& Bindings = Slot->Listeners->Bindings;
+	auto WriteBindings = [&Bindings](const auto& Value)
+	{
+		using ValueType = std::decay_t<decltype(Value)>;
+
+		for (int32 Index = Bindings.Num() - 1; Index >= 0; --Index)
+		{
+			const FSettingBinding& Binding = Bindings[Index];
+			if (!Binding.Owner.IsValid())
+			{
+				Bindings.RemoveAtSwap(Index, 1, false);
+				continue;
+			}
+
+			switch (Binding.Kind)
+			{
+			case FSettingBinding::EKind::Value:
+				*static_cast<ValueType*>(Binding.Address) = Value;
+				break;
+			case FSettingBinding::EKind::Double:
+				if constexpr (std::is_same_v<ValueType, float>)
+				{
+					*static_cast<double*>(Binding.Address) = Value;
+				}
+				break;
+			case FSettingBinding::EKind::BitfieldBool:
+				if constexpr (std::is_same_v<ValueType, bool>)
+				{
+					Binding.BoolProperty->SetPropertyValue(Binding.Address, Value);
+				}
+				break;
+			}
+		}
+	};
+
+	const int32 TypedIndex = Slot->TypedIndex;
+	switch (Slot->Type)
+	{
+	case ESettingType::Float:
+		WriteBindings(FloatStorage.Current[TypedIndex]);
+		break;
+	case ESettingType::OpposingToggles:
+		WriteBindings(OpposingTogglesStorage.bFirstIsActive[TypedIndex]);
+		break;
+	case ESettingType::Enum:
+		WriteBindings(EnumStorage.Current[TypedIndex]);
+		break;
+	case ESettingType::Derived:
+		WriteBindings(EvaluateDerivedSetting(TypedIndex));
+		break;
+	default:
+		VisitTupleElements([Slot, TypedIndex, &WriteBindings](const auto& Storage)
+		{
+			if (Storage.Type == Slot->Type)
+			{
+				WriteBindings(Storage.Current[TypedIndex]);
+			}
+		}, GenericStorages);
+		break;
+	}
+}
+
+void UEasySettingsRegistry::WriteFloatSetting(FSettingHandle Handle, int32 TypedIndex, float NewCurrent, bool bWriteToConfig)
+{
+	if (bWriteToConfig)
+	{
+		EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_ConfigWrite);
+
+		const FSettingBase& ID = SlotMetadata[Handle.GetIndex()].ID;
+		GConfig->SetFloat(*ID.Section, *ID.Key, NewCurrent, ID.GetIniFileName());
+		PreviewedFloatSettings.Remove(Handle);
+	}
+
+	FloatStorage.Current[TypedIndex] = NewCurrent;
+	ValueTable->PublishFloat(Handle, NewCurrent);
+	DiscardPendingValue(Handle);
+	WriteSettingBindings(Handle);
+	MarkDerivedDirty(Handle);
+}
+
+void UEasySettingsRegistry::WriteOpposingTogglesSetting(FSettingHandle Handle, int32 TypedIndex, bool bActivateFirst, bool bWriteToConfig)
+{
+	if (bWriteToConfig)
+	{
+		EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_ConfigWrite);
+
+		// The tokens were lowercased on registration.
+		const FString& NewActive = OpposingTogglesStorage.GetToken(TypedIndex, bActivateFirst);
+
+		const FSettingBase& ID = SlotMetadata[Handle.GetIndex()].ID;
+		GConfig->SetString(*ID.Section, *ID.Key, *NewActive, ID.GetIniFileName());
+		PreviewedOpposingTogglesSettings.Remove(Handle);
+	}
+
+	OpposingTogglesStorage.bFirstIsActive[TypedIndex] = bActivateFirst;
+	ValueTable->PublishBool(Handle, bActivateFirst);
+	DiscardPendingValue(Handle);
+	WriteSettingBindings(Handle);
+	MarkDerivedDirty(Handle);
+}
+
+void UEasySettingsRegistry::WriteEnumSetting(FSettingHandle Handle, int32 TypedIndex, int32 NewCurrent, bool bWriteToConfig)
+{
+	if (bWriteToConfig)
+	{
+		EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_ConfigWrite);
+
+		const FSettingBase& ID = SlotMetadata[Handle.GetIndex()].ID;
+		GConfig->SetString(*ID.Section, *ID.Key, *EnumStorage.GetToken(TypedIndex, NewCurrent), ID.GetIniFileName());
+		PreviewedEnumSettings.Remove(Handle);
+	}
+
+	EnumStorage.Current[TypedIndex] = NewCurrent;
+	ValueTable->PublishInt(Handle, NewCurrent);
+	DiscardPendingValue(Handle);
+	WriteSettingBindings(Handle);
+	MarkDerivedDirty(Handle);
+}
+
+template <typename SettingType>
+void UEasySettingsRegistry::WriteSetting(FSettingHandle Handle, int32 TypedIndex, const typename TSettingTraits<SettingType>::ValueType& NewCurrent, bool bWriteToConfig)
+{
+	using FTraits = TSettingTraits<SettingType>;
+
+	if (bWriteToConfig)
+	{
+		EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_ConfigWrite);
+
+		const FSettingBase& ID = SlotMetadata[Handle.GetIndex()].ID;
+		GConfig->SetString(*ID.Section, *ID.Key, *FTraits::ToString(NewCurrent), ID.GetIniFileName());
+		GetStorage<SettingType>().Previewed.Remove(Handle);
+	}
+
+	GetStorage<SettingType>().Current[TypedIndex] = NewCurrent;
+
+	if constexpr (FTraits::bHasValueBits)
+	{
+		ValueTable->PublishInt(Handle, int32(FTraits::ToBits(NewCurrent)));
+	}
+
+	DiscardPendingValue(Handle);
+	WriteSettingBindings(Handle);
+	MarkDerivedDirty(Handle);
+}
+
+void UEasySettingsRegistry::WriteSettingsSnapshot()
+{
+	TArray<FEasySettingsSnapshot::FEntry> Entries;
+	Entries.Reserve(FloatStorage.Num() + OpposingTogglesStorage.Num() + EnumStorage.Num());
+
+	TArray<FString> IniFileNames;
+
+	for (int32 TypedIndex = 0; TypedIndex < FloatStorage.Num(); ++TypedIndex)
+	{
+		const FSettingSlotMetadata& Metadata = SlotMetadata[FloatStorage.SlotIndices[TypedIndex]];
+
+		FEasySettingsSnapshot::FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.KeyHash = Metadata.KeyHash;
+		Entry.SchemaHash = FEasySettingsSnapshot::GetFloatSchemaHash(FloatStorage.Min[TypedIndex], FloatStorage.Max[TypedIndex]);
+		FMemory::Memcpy(&Entry.ValueBits, &FloatStorage.Current[TypedIndex], sizeof(Entry.ValueBits));
+
+		IniFileNames.AddUnique(Metadata.ID.GetIniFileName());
+	}
+
+	for (int32 TypedIndex = 0; TypedIndex < OpposingTogglesStorage.Num(); ++TypedIndex)
+	{
+		const FSettingSlotMetadata& Metadata = SlotMetadata[OpposingTogglesStorage.SlotIndices[TypedIndex]];
+
+		FEasySettingsSnapshot::FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.KeyHash = Metadata.KeyHash;
+		Entry.SchemaHash = FEasySettingsSnapshot::GetOpposingTogglesSchemaHash(OpposingTogglesStorage.GetToggle(TypedIndex, true), OpposingTogglesStorage.GetToggle(TypedIndex, false));
+		Entry.ValueBits = OpposingTogglesStorage.bFirstIsActive[TypedIndex] ? 1 : 0;
+
+		IniFileNames.AddUnique(Metadata.ID.GetIniFileName());
+	}
+
+	for (int32 TypedIndex = 0; TypedIndex < EnumStorage.Num(); ++TypedIndex)
+	{
+		const FSettingSlotMetadata& Metadata = SlotMetadata[EnumStorage.SlotIndices[TypedIndex]];
+
+		FEasySettingsSnapshot::FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.KeyHash = Metadata.KeyHash;
+		Entry.SchemaHash = FEasySettingsSnapshot::GetEnumSchemaHash(EnumStorage.OptionSets[TypedIndex]->Options);
+		Entry.ValueBits = uint32(EnumStorage.Current[TypedIndex]);
+
+		IniFileNames.AddUnique(Metadata.ID.GetIniFileName());
+	}
+
+	// Values that don't fit in 32 bits are always read back from the ini.
+	VisitTupleElements([this, &Entries, &IniFileNames](const auto& Storage)
+	{
+		using FTraits = typename std::decay_t<decltype(Storage)>::FTraits;
+
+		if constexpr (FTraits::bHasValueBits)
+		{
+			for (int32 TypedIndex = 0; TypedIndex < Storage.Num(); ++TypedIndex)
+			{
+				const FSettingSlotMetadata& Metadata = SlotMetadata[Storage.SlotIndices[TypedIndex]];
+
+				FEasySettingsSnapshot::FEntry& Entry = Entries.AddDefaulted_GetRef();
+				Entry.KeyHash = Metadata.KeyHash;
+				Entry.SchemaHash = FTraits::GetSchemaHash(Storage.Rules[TypedIndex]);
+				Entry.ValueBits = FTraits::ToBits(Storage.Current[TypedIndex]);
+
+				IniFileNames.AddUnique(Metadata.ID.GetIniFileName());
+			}
+		}
+	}, GenericStorages);
+
+	// The mapped file has to be released before it can be overwritten.
+	Snapshot.Reset();
+	FEasySettingsSnapshot::Write(FEasySettingsSnapshot::GetDefaultFilename(), Entries, IniFileNames);
+}
+
+void UEasySettingsRegistry::BroadcastGlobalDelegate(FSettingHandle Handle)
+{
+	const FSettingSlot* Slot = ResolveSlot(Handle);
+	if (!Slot)
+	{
+		return;
+	}
+
+	EASYSETTINGS_SCOPE_CYCLE_COUNTER(STAT_EasySettings_Broadcast);
+
+	// Copy the ID, listeners are free to register or release settings while being notified.
+	const FSettingBase SettingID = SlotMetadata[Handle.GetIndex()].ID;
+	switch (Slot->Type)
+	{
+	case ESettingType::Float:
+		FloatSettingChangedDelegate.Broadcast(SettingID, FloatStorage.Current[Slot->TypedIndex]);
+		break;
+	case ESettingType::OpposingToggles:
+		OpposingTogglesSettingChangedDelegate.Broadcast(SettingID, OpposingTogglesStorage.bFirstIsActive[Slot->TypedIndex]);
+		break;
+	case ESettingType::Enum:
+		EnumSettingChangedDelegate.Broadcast(SettingID, EnumStorage.Current[Slot->TypedIndex]);
+		break;
+	default:
+		SettingChangedDelegate.Broadcast(SettingID, Handle);
+		break;
+	}
+}
+
+// The generic setting functions are defined here rather than in the header, so they are compiled once for every type the registry supports.
+#define EASYSETTINGS_INSTANTIATE_SETTING(SettingType) \
+	template FSettingHandle UEasySettingsRegistry::SetupSetting<SettingType>(SettingType&, bool&); \
+	template bool UEasySettingsRegistry::TryGetValue<SettingType>(FSettingHandle, TSettingTraits<SettingType>::ValueType&) const; \
+	template bool UEasySettingsRegistry::GetSetting<SettingType>(FSettingHandle, SettingType&) const; \
+	template bool UEasySettingsRegistry::UpdateSetting<SettingType>(FSettingHandle, const TSettingTraits<SettingType>::ValueType&); \
+	template bool UEasySettingsRegistry::StageSetting<SettingType>(FSettingHandle, const TSettingTraits<SettingType>::ValueType&); \
+	template bool UEasySettingsRegistry::SetPendingValue<SettingType>(FSettingHandle, const TSettingTraits<SettingType>::ValueType&); \
+	template bool UEasySettingsRegistry::TryGetPendingValue<SettingType>(FSettingHandle, TSettingTraits<SettingType>::ValueType&) const;
+
+EASYSETTINGS_FOR_EACH_GENERIC_SETTING(EASYSETTINGS_INSTANTIATE_SETTING)
+
+#undef EASYSETTINGS_INSTANTIATE_SETTING
+
+template bool UEasySettingsRegistry::BindMemberToSetting<float>(FSettingHandle, UObject*, float*);
+template bool UEasySettingsRegistry::BindMemberToSetting<bool>(FSettingHandle, UObject*, bool*);
+template bool UEasySettingsRegistry::BindMemberToSetting<int32>(FSettingHandle, UObject*, int32*);
+template bool UEasySettingsRegistry::BindMemberToSetting<FVector2D>(FSettingHandle, UObject*, FVector2D*);
+template bool UEasySettingsRegistry::BindMemberToSetting<FLinearColor>(FSettingHandle, UObject*, FLinearColor*);
+template bool UEasySettingsRegistry::BindMemberToSetting<FKey>(FSettingHandle, UObject*, FKey*);
@@ -0,0 +1,240 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsSchema.h"
+#include "EasySettings.h"
+#include "EasySettingsSnapshot.h"
+#include "EasySettingsTraits.h"
+#include "Algo/StableSort.h"
+
+namespace EasySettingsSchema
+{
+	static void AddError(TArray<FText>& OutErrors, const FSettingBase& ID, const TCHAR* Problem)
+	{
+		OutErrors.Add(FText::FromString(FString::Printf(TEXT("%s: %s"), *ID.GetTMapKey(), Problem)));
+	}
+
+	/** Returns the schema entry a baked setting was made from. */
+	static const FSettingBase& GetSettingID(const UEasySettingsSchema& Schema, const FEasySettingsBakedSetting& Baked)
+	{
+		switch (ESettingType(Baked.Type))
+		{
+		case ESettingType::Float:
+			return Schema.FloatSettings[Baked.Index];
+		case ESettingType::OpposingToggles:
+			return Schema.OpposingTogglesSettings[Baked.Index];
+#define EASYSETTINGS_GET_SETTING_ID(SettingType) \
+		case TSettingTraits<SettingType>::Type: \
+			return Schema.GetSettings<SettingType>()[Baked.Index];
+		EASYSETTINGS_FOR_EACH_GENERIC_SETTING(EASYSETTINGS_GET_SETTING_ID)
+#undef EASYSETTINGS_GET_SETTING_ID
+		default:
+			return Schema.EnumSettings[Baked.Index];
+		}
+	}
+}
+
+bool UEasySettingsSchema::Validate(TArray<FText>& OutErrors) const
+{
+	using namespace EasySettingsSchema;
+
+	const int32 NumErrors = OutErrors.Num();
+
+	// Registering a second setting under the same key hands back the first one, so the second would never be used.
+	TSet<FString> Keys;
+	auto CheckID = [&OutErrors, &Keys](const FSettingBase& ID)
+	{
+		if (ID.Key.IsEmpty())
+		{
+			AddError(OutErrors, ID, TEXT("Key is empty."));
+		}
+
+		bool bAlreadyInSet = false;
+		Keys.Add(ID.GetTMapKey(), &bAlreadyInSet);
+		if (bAlreadyInSet)
+		{
+			AddError(OutErrors, ID, TEXT("Another setting in the schema uses the same ini file, section and key."));
+		}
+	};
+
+	for (const FFloatSetting& Setting : FloatSettings)
+	{
+		CheckID(Setting);
+
+		if (Setting.Min > Setting.Max)
+		{
+			AddError(OutErrors, Setting, TEXT("Min is greater than Max."));
+		}
+		else if (Setting.Default < Setting.Min || Setting.Default > Setting.Max)
+		{
+			AddError(OutErrors, Setting, TEXT("Default is not within Min and Max."));
+		}
+	}
+
+	for (const FOpposingTogglesSetting& Setting : OpposingTogglesSettings)
+	{
+		CheckID(Setting);
+
+		// The ini value is matched without case, so toggles that only differ by case can't be told apart.
+		if (Setting.FirstToggle.IsEmpty() || Setting.SecondToggle.IsEmpty())
+		{
+			AddError(OutErrors, Setting, TEXT("FirstToggle and SecondToggle need a name."));
+		}
+		else if (Setting.FirstToggle.Equals(Setting.SecondToggle, ESearchCase::IgnoreCase))
+		{
+			AddError(OutErrors, Setting, TEXT("FirstToggle and SecondToggle are the same."));
+		}
+	}
+
+	for (const FEnumSetting& Setting : EnumSettings)
+	{
+		CheckID(Setting);
+
+		if (Setting.Options.Num() == 0)
+		{
+			AddError(OutErrors, Setting, TEXT("There are no Options."));
+		}
+		else if (!Setting.ValidateEnumSetting(Setting.Default))
+		{
+			AddError(OutErrors, Setting, TEXT("Default is not the index of one of the Options."));
+		}
+	}
+
+	// The generic types validate their Default the same way their Setup does.
+	auto CheckSettings = [&OutErrors, &CheckID](const auto& Settings)
+	{
+		using FTraits = TSettingTraits<typename std::decay_t<decltype(Settings)>::ElementType>;
+
+		for (const auto& Setting : Settings)
+		{
+			CheckID(Setting);
+
+			if (!FTraits::IsValid(FTraits::GetRules(Setting), Setting.Default))
+			{
+				AddError(OutErrors, Setting, TEXT("Default did not pass the setting's validator."));
+			}
+		}
+	};
+
+#define EASYSETTINGS_CHECK_SETTINGS(SettingType) CheckSettings(GetSettings<SettingType>());
+	EASYSETTINGS_FOR_EACH_GENERIC_SETTING(EASYSETTINGS_CHECK_SETTINGS)
+#undef EASYSETTINGS_CHECK_SETTINGS
+
+	return OutErrors.Num() == NumErrors;
+}
+
+int32 UEasySettingsSchema::GetNumSettings() const
+{
+	int32 NumSettings = FloatSettings.Num() + OpposingTogglesSettings.Num() + EnumSettings.Num();
+#define EASYSETTINGS_ADD_NUM_SETTINGS(SettingType) NumSettings += GetSettings<SettingType>().Num();
+	EASYSETTINGS_FOR_EACH_GENERIC_SETTING(EASYSETTINGS_ADD_NUM_SETTINGS)
+#undef EASYSETTINGS_ADD_NUM_SETTINGS
+	return NumSettings;
+}
+
+bool UEasySettingsSchema::RegistrationOrderLess(const FSettingBase& A, const FSettingBase& B)
+{
+	if (A.IniFile != B.IniFile)
+	{
+		return A.IniFile < B.IniFile;
+	}
+	if (A.IniFile == EIniFile::Sharded && A.Shard != B.Shard)
+	{
+		return A.Shard.Compare(B.Shard) < 0;
+	}
+	return A.Section.Compare(B.Section, ESearchCase::IgnoreCase) < 0;
+}
+
+void UEasySettingsSchema::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	// Only cooked schemas are baked. Saved in the editor, the baked settings would go stale as soon as a setting is edited.
+	if (ObjectSaveContext.IsCooking())
+	{
+		Bake();
+	}
+	else
+	{
+		BakedSettings.Empty();
+	}
+}
+
+#if WITH_EDITOR
+EDataValidationResult UEasySettingsSchema::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	const EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+	if (!Validate(ValidationErrors))
+	{
+		return EDataValidationResult::Invalid;
+	}
+
+	return Result == EDataValidationResult::Invalid ? Result : EDataValidationResult::Valid;
+}
+#endif
+
+void UEasySettingsSchema::Bake()
+{
+	using namespace EasySettingsSchema;
+
+	BakedSettings.Reset();
+
+	// Errors fail the cook. A schema that is cooked anyway is registered without its baked settings, so the Setup checks still run.
+	TArray<FText> Errors;
+	if (!Validate(Errors))
+	{
+		for (const FText& Error : Errors)
+		{
+			UE_LOG(LogEasySettings, Error, TEXT("%s is not a valid EasySettingsSchema. %s"), *GetPathName(), *Error.ToString());
+		}
+		return;
+	}
+
+	BakedSettings.Reserve(GetNumSettings());
+	auto AddBaked = [this](const FSettingBase& ID, ESettingType Type, int32 Index, uint32 SchemaHash)
+	{
+		FEasySettingsBakedSetting& Baked = BakedSettings.AddDefaulted_GetRef();
+		Baked.Type = uint8(Type);
+		Baked.Index = Index;
+		Baked.TMapKey = ID.GetTMapKey();
+		Baked.KeyHash = FEasySettingsSnapshot::HashKey(Baked.TMapKey);
+		Baked.SchemaHash = SchemaHash;
+	};
+
+	for (int32 Index = 0; Index < FloatSettings.Num(); ++Index)
+	{
+		const FFloatSetting& Setting = FloatSettings[Index];
+		AddBaked(Setting, ESettingType::Float, Index, FEasySettingsSnapshot::GetFloatSchemaHash(Setting.Min, Setting.Max));
+	}
+	for (int32 Index = 0; Index < OpposingTogglesSettings.Num(); ++Index)
+	{
+		const FOpposingTogglesSetting& Setting = OpposingTogglesSettings[Index];
+		AddBaked(Setting, ESettingType::OpposingToggles, Index, FEasySettingsSnapshot::GetOpposingTogglesSchemaHash(Setting.FirstToggle, Setting.SecondToggle));
+	}
+	for (int32 Index = 0; Index < EnumSettings.Num(); ++Index)
+	{
+		const FEnumSetting& Setting = EnumSettings[Index];
+		AddBaked(Setting, ESettingType::Enum, Index, FEasySettingsSnapshot::GetEnumSchemaHash(Setting.Options));
+	}
+
+	auto AddBakedSettings = [&AddBaked](const auto& Settings)
+	{
+		using FTraits = TSettingTraits<typename std::decay_t<decltype(Settings)>::ElementType>;
+
+		for (int32 Index = 0; Index < Settings.Num(); ++Index)
+		{
+			AddBaked(Settings[Index], FTraits::Type, Index, FTraits::GetSchemaHash(FTraits::GetRules(Settings[Index])));
+		}
+	};
+
+#define EASYSETTINGS_BAKE_SETTINGS(SettingType) AddBakedSettings(GetSettings<SettingType>());
+	EASYSETTINGS_FOR_EACH_GENERIC_SETTING(EASYSETTINGS_BAKE_SETTINGS)
+#undef EASYSETTINGS_BAKE_SETTINGS
+
+	// Stable, so settings sharing a section keep the order they were declared in.
+	Algo::StableSort(BakedSettings, [this](const FEasySettingsBakedSetting& A, const FEasySettingsBakedSetting& B)
+	{
+		return RegistrationOrderLess(GetSettingID(*this, A), GetSettingID(*this, B));
+	});
+
+	UE_LOG(LogEasySettings, Verbose, TEXT("Baked %d settings into %s"), BakedSettings.Num(), *GetPathName());
+}
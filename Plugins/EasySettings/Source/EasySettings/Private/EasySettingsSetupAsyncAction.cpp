@@ -0,0 +1,74 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsSetupAsyncAction.h"
+#include "EasySettingsRegistry.h"
+
+UEasySettingsSetupAsyncAction* UEasySettingsSetupAsyncAction::SetupFloatSettingAsync(UObject* WorldContextObject, FFloatSetting Setting)
+{
+	UEasySettingsSetupAsyncAction* Action = Create(WorldContextObject);
+	Action->Type = ESettingType::Float;
+	Action->FloatSetting = Setting;
+	return Action;
+}
+
+UEasySettingsSetupAsyncAction* UEasySettingsSetupAsyncAction::SetupOpposingTogglesSettingAsync(UObject* WorldContextObject, FOpposingTogglesSetting Setting)
+{
+	UEasySettingsSetupAsyncAction* Action = Create(WorldContextObject);
+	Action->Type = ESettingType::OpposingToggles;
+	Action->OpposingTogglesSetting = Setting;
+	return Action;
+}
+
+UEasySettingsSetupAsyncAction* UEasySettingsSetupAsyncAction::SetupEnumSettingAsync(UObject* WorldContextObject, FEnumSetting Setting)
+{
+	UEasySettingsSetupAsyncAction* Action = Create(WorldContextObject);
+	Action->Type = ESettingType::Enum;
+	Action->EnumSetting = Setting;
+	return Action;
+}
+
+void UEasySettingsSetupAsyncAction::Activate()
+{
+	UEasySettingsRegistry* Registry = UEasySettingsRegistry::TryGetForCaller(TEXT("UEasySettingsSetupAsyncAction::Activate"));
+	if (!Registry)
+	{
+		Resolved.Broadcast(FSettingHandle());
+		SetReadyToDestroy();
+		return;
+	}
+
+	TFuture<FSettingHandle> Future;
+	switch (Type)
+	{
+	case ESettingType::Float:
+		Future = Registry->SetupFloatSettingAsync(FloatSetting);
+		break;
+	case ESettingType::OpposingToggles:
+		Future = Registry->SetupOpposingTogglesSettingAsync(OpposingTogglesSetting);
+		break;
+	case ESettingType::Enum:
+		Future = Registry->SetupEnumSettingAsync(EnumSetting);
+		break;
+	default:
+		Future = MakeFulfilledPromise<FSettingHandle>(FSettingHandle()).GetFuture();
+		break;
+	}
+
+	// The registry sets the future on the game thread, so Blueprint is called back there.
+	TWeakObjectPtr<UEasySettingsSetupAsyncAction> WeakThis(this);
+	Future.Next([WeakThis](FSettingHandle Handle)
+	{
+		if (UEasySettingsSetupAsyncAction* Action = WeakThis.Get())
+		{
+			Action->Resolved.Broadcast(Handle);
+			Action->SetReadyToDestroy();
+		}
+	});
+}
+
+UEasySettingsSetupAsyncAction* UEasySettingsSetupAsyncAction::Create(UObject* WorldContextObject)
+{
+	UEasySettingsSetupAsyncAction* Action = NewObject<UEasySettingsSetupAsyncAction>();
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
@@ -0,0 +1,224 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsSnapshot.h"
+#include "EasySettings.h"
+#include "EasySettingsTraits.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FEasySettingsSnapshot::FEasySettingsSnapshot()
+{
+}
+
+FEasySettingsSnapshot::~FEasySettingsSnapshot()
+{
+	Reset();
+}
+
+bool FEasySettingsSnapshot::Load(const FString& Filename)
+{
+	Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Filename))
+	{
+		return false;
+	}
+
+	MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+	if (MappedFile.IsValid())
+	{
+		MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	}
+
+	bool bParsed = false;
+	if (MappedRegion.IsValid())
+	{
+		bParsed = ParseLoadedBytes(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+	}
+	else if (FFileHelper::LoadFileToArray(LoadedBytes, *Filename, FILEREAD_Silent))
+	{
+		// Not every platform supports memory mapping, reading a few KB is fine as a fallback.
+		bParsed = ParseLoadedBytes(LoadedBytes.GetData(), LoadedBytes.Num());
+	}
+
+	if (!bParsed)
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("Ignoring malformed settings snapshot %s, settings will be read from the ini files."), *Filename);
+		Reset();
+	}
+
+	return bParsed;
+}
+
+void FEasySettingsSnapshot::Reset()
+{
+	IniFiles = nullptr;
+	NumIniFiles = 0;
+	Entries = nullptr;
+	NumEntries = 0;
+	IniFileFreshness.Reset();
+
+	// The region has to be released before the file it was mapped from.
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	LoadedBytes.Empty();
+}
+
+bool FEasySettingsSnapshot::TryFind(uint64 KeyHash, uint32 SchemaHash, const FString& IniFileName, uint32& OutValueBits)
+{
+	if (NumEntries == 0 || !IsIniFileFresh(IniFileName))
+	{
+		return false;
+	}
+
+	const TArrayView<const FEntry> EntryView(Entries, NumEntries);
+	const int32 Index = Algo::LowerBoundBy(EntryView, KeyHash, &FEntry::KeyHash);
+	if (Index >= NumEntries || Entries[Index].KeyHash != KeyHash || Entries[Index].SchemaHash != SchemaHash)
+	{
+		return false;
+	}
+
+	OutValueBits = Entries[Index].ValueBits;
+	return true;
+}
+
+void FEasySettingsSnapshot::InvalidateIniFile(const FString& IniFileName)
+{
+	IniFileFreshness.Add(IniFileName, false);
+}
+
+bool FEasySettingsSnapshot::Write(const FString& Filename, TArray<FEntry>& Entries, const TArray<FString>& IniFileNames)
+{
+	Algo::SortBy(Entries, &FEntry::KeyHash);
+
+	TArray<FIniFileRecord> IniFileRecords;
+	IniFileRecords.Reserve(IniFileNames.Num());
+	for (const FString& IniFileName : IniFileNames)
+	{
+		FIniFileRecord& Record = IniFileRecords.AddDefaulted_GetRef();
+		Record.NameHash = HashKey(IniFileName);
+		Record.ContentHash = HashIniFileContents(IniFileName);
+	}
+
+	FHeader Header;
+	Header.Magic = SnapshotMagic;
+	Header.Version = SnapshotVersion;
+	Header.NumIniFiles = IniFileRecords.Num();
+	Header.NumEntries = Entries.Num();
+
+	TArray<uint8> Bytes;
+	Bytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+	Bytes.Append(reinterpret_cast<const uint8*>(IniFileRecords.GetData()), IniFileRecords.Num() * sizeof(FIniFileRecord));
+	Bytes.Append(reinterpret_cast<const uint8*>(Entries.GetData()), Entries.Num() * sizeof(FEntry));
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *Filename))
+	{
+		UE_LOG(LogEasySettings, Warning, TEXT("Failed to write settings snapshot %s."), *Filename);
+		return false;
+	}
+
+	return true;
+}
+
+FString FEasySettingsSnapshot::GetDefaultFilename()
+{
+	return FPaths::Combine(FPaths::GetPath(GetIniFilePathOnDisk(GGameUserSettingsIni)), TEXT("EasySettings.snapshot"));
+}
+
+uint64 FEasySettingsSnapshot::HashKey(const FString& TMapKey)
+{
+	return CityHash64(reinterpret_cast<const char*>(*TMapKey), TMapKey.Len() * sizeof(TCHAR));
+}
+
+uint32 FEasySettingsSnapshot::GetFloatSchemaHash(float Min, float Max)
+{
+	return HashCombine(HashCombine(::GetTypeHash(uint8(ESettingType::Float)), ::GetTypeHash(Min)), ::GetTypeHash(Max));
+}
+
+uint32 FEasySettingsSnapshot::GetOpposingTogglesSchemaHash(const FString& FirstToggle, const FString& SecondToggle)
+{
+	return HashCombine(HashCombine(::GetTypeHash(uint8(ESettingType::OpposingToggles)), ::GetTypeHash(FirstToggle)), ::GetTypeHash(SecondToggle));
+}
+
+uint32 FEasySettingsSnapshot::GetEnumSchemaHash(const TArray<FString>& Options)
+{
+	uint32 Hash = ::GetTypeHash(uint8(ESettingType::Enum));
+	for (const FString& Option : Options)
+	{
+		Hash = HashCombine(Hash, ::GetTypeHash(Option));
+	}
+	return Hash;
+}
+
+FString FEasySettingsSnapshot::GetIniFilePathOnDisk(const FString& IniFileName)
+{
+	// GConfig may refer to global ini files by their short name, so always go through the base name.
+	return FConfigCacheIni::GetDestIniFilename(*FPaths::GetBaseFilename(IniFileName), nullptr, *FPaths::GeneratedConfigDir());
+}
+
+uint64 FEasySettingsSnapshot::HashIniFileContents(const FString& IniFileName)
+{
+	TArray<uint8> Contents;
+	if (!FFileHelper::LoadFileToArray(Contents, *GetIniFilePathOnDisk(IniFileName), FILEREAD_Silent))
+	{
+		return 0;
+	}
+
+	return CityHash64(reinterpret_cast<const char*>(Contents.GetData()), Contents.Num());
+}
+
+bool FEasySettingsSnapshot::ParseLoadedBytes(const uint8* Data, int64 Size)
+{
+	if (!Data || Size < int64(sizeof(FHeader)))
+	{
+		return false;
+	}
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	if (Header.Magic != SnapshotMagic || Header.Version != SnapshotVersion)
+	{
+		return false;
+	}
+
+	const int64 ExpectedSize = sizeof(FHeader) + int64(Header.NumIniFiles) * sizeof(FIniFileRecord) + int64(Header.NumEntries) * sizeof(FEntry);
+	if (Size != ExpectedSize)
+	{
+		return false;
+	}
+
+	IniFiles = reinterpret_cast<const FIniFileRecord*>(Data + sizeof(FHeader));
+	NumIniFiles = Header.NumIniFiles;
+	Entries = reinterpret_cast<const FEntry*>(Data + sizeof(FHeader) + NumIniFiles * sizeof(FIniFileRecord));
+	NumEntries = Header.NumEntries;
+	return true;
+}
+
+bool FEasySettingsSnapshot::IsIniFileFresh(const FString& IniFileName)
+{
+	if (const bool* bCachedFresh = IniFileFreshness.Find(IniFileName))
+	{
+		return *bCachedFresh;
+	}
+
+	bool bFresh = false;
+	const uint64 NameHash = HashKey(IniFileName);
+	for (int32 Index = 0; Index < NumIniFiles; ++Index)
+	{
+		if (IniFiles[Index].NameHash == NameHash)
+		{
+			const uint64 ContentHash = HashIniFileContents(IniFileName);
+			bFresh = ContentHash != 0 && ContentHash == IniFiles[Index].ContentHash;
+			break;
+		}
+	}
+
+	IniFileFreshness.Add(IniFileName, bFresh);
+	return bFresh;
+}
@@ -1,238 +1,537 @@
 // Copyright Nathan Ralph. All Rights Reserved.
 
 #include "EasySettingsStatics.h"
-#include "Kismet/GameplayStatics.h"
+#include "EasySettings.h"
+#include "EasySettingsRegistry.h"
+#include "EasySettingsStats.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogEasySettings, Log, All);
+namespace EasySettingsStatics
+{
+	/** Shared by the Get<Type>SettingValue functions of every generic setting type. */
+	template <typename SettingType>
+	static bool GetSettingValue(FSettingHandle Handle, typename TSettingTraits<SettingType>::ValueType& OutCurrent, const TCHAR* FunctionName)
+	{
+		return UEasySettingsRegistry::WithRegistry(FunctionName, false, [Handle, &OutCurrent, FunctionName](UEasySettingsRegistry& Registry)
+		{
+			if (Registry.TryGetValue<SettingType>(Handle, OutCurrent))
+			{
+				return true;
+			}
+
+			UE_LOG(LogEasySettings, Warning, TEXT("%s() called with a handle that does not refer to a registered setting of that type. Handle index was %d"), FunctionName, Handle.GetIndex());
+			return false;
+		});
+	}
+
+	/** Shared by the Update<Type>SettingByHandle functions of every generic setting type. */
+	template <typename SettingType>
+	static bool UpdateSettingByHandle(FSettingHandle Handle, const typename TSettingTraits<SettingType>::ValueType& NewCurrent, const TCHAR* FunctionName)
+	{
+		return UEasySettingsRegistry::WithRegistry(FunctionName, false, [Handle, &NewCurrent, FunctionName](UEasySettingsRegistry& Registry)
+		{
+			if (Registry.GetSettingType(Handle) == TSettingTraits<SettingType>::Type)
+			{
+				return Registry.UpdateSetting<SettingType>(Handle, NewCurrent);
+			}
+
+			UE_LOG(LogEasySettings, Warning, TEXT("%s() called with a handle that does not refer to a registered setting of that type. Handle index was %d"), FunctionName, Handle.GetIndex());
+			return false;
+		});
+	}
+}
 
 void UEasySettingsStatics::SetupFloatSetting(const UObject* WorldContextObject, FFloatSetting& Setting, bool& bOutSuccess)
 {
-	bOutSuccess = false;
+	FSettingHandle Handle;
+	SetupFloatSettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
 
-	FString IniFileName = Setting.GetIniFileName();
-	FString TMapKey = Setting.GetTMapKey();
-	UEasySettingsSubsystem& SubSys = GetESSubsystem(WorldContextObject);
+void UEasySettingsStatics::SetupFloatSettingWithHandle(const UObject* WorldContextObject, FFloatSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupFloatSettingWithHandle);
 
-	// Check if the setting is in the config file yet.
-	float FloatReceived;
-	if (GConfig->GetFloat(*Setting.Section, *Setting.Key, FloatReceived, IniFileName) && Setting.ValidateFloatSetting(FloatReceived))
+	bOutSuccess = false;
+	OutHandle = UEasySettingsRegistry::WithRegistry(TEXT("SetupFloatSettingWithHandle"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
 	{
-		// Successfully found a usable float in the ini.
-		Setting.Current = FloatReceived;
-		bOutSuccess = true;
-	}
-	else
+		return Registry.SetupFloatSetting(Setting, bOutSuccess);
+	});
+}
+
+void UEasySettingsStatics::GetFloatSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool& bOutSuccess, FFloatSetting& OutSetting)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetFloatSetting);
+
+	bOutSuccess = false;
+
+	FString TMapKey = SettingID.GetTMapKey();
+	UEasySettingsRegistry::WithRegistry(TEXT("GetFloatSetting"), [&](UEasySettingsRegistry& Registry)
 	{
-		float DefaultFloat = 0.f;
-		if (Setting.ValidateFloatSetting(Setting.Default))
+		// We don't need to handle the possibility of someone changing this setting manually in the ini, as we are just referencing what is already in memory.
+		// The Setup function ensures what is in the ini falls within bounds prior to storing it in memory.
+		if (Registry.GetFloatSetting(Registry.FindHandle(TMapKey), OutSetting))
 		{
-			DefaultFloat = Setting.Default;
 			bOutSuccess = true;
 		}
 		else
 		{
-			// Print error to log if the struct was set up incorrectly.
-			UE_LOG(LogEasySettings, Error, TEXT("Setting.Default was not within Min and Max values. Setting the Default for this to 0. Setting TMap key was %s"), *TMapKey);
+			// It was never registered through the Setup function, don't signal a success.
+			UE_LOG(LogEasySettings, Warning, TEXT("GetFloatSetting() called on a FloatSetting that was never registered with SetupFloatSetting(). Setting TMap key was %s"), *TMapKey);
 		}
+	});
+}
 
-		// We didn't find any usable value in the config file, so set it in ini as the default value.
-		GConfig->SetFloat(*Setting.Section, *Setting.Key, DefaultFloat, IniFileName);
-		GConfig->Flush(false, IniFileName);
-		Setting.Current = DefaultFloat;
-	}
+void UEasySettingsStatics::UpdateFloatSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, float NewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateFloatSetting);
 
-	if (!SubSys.FloatSettings.Contains(TMapKey))
+	bOutSuccess = false;
+
+	FString TMapKey = SettingID.GetTMapKey();
+	UEasySettingsRegistry::WithRegistry(TEXT("UpdateFloatSetting"), [&](UEasySettingsRegistry& Registry)
 	{
-		SubSys.FloatSettings.Add(TMapKey, &Setting);
-	}
-	else
+		FSettingHandle Handle = Registry.FindHandle(TMapKey);
+		if (Registry.GetSettingType(Handle) == ESettingType::Float)
+		{
+			bOutSuccess = Registry.UpdateFloatSetting(Handle, NewCurrent);
+		}
+		else
+		{
+			// Either it was never setup, or it was out of bounds. We changed nothing.
+			UE_LOG(LogEasySettings, Warning, TEXT("UpdateFloatSetting() called on a FloatSetting that was never setup with SetupFloatSetting(). Setting TMap key was %s"), *TMapKey);
+		}
+	});
+}
+
+void UEasySettingsStatics::GetFloatSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FFloatSetting& OutSetting)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetFloatSettingByHandle);
+
+	bOutSuccess = false;
+
+	UEasySettingsRegistry::WithRegistry(TEXT("GetFloatSettingByHandle"), [&](UEasySettingsRegistry& Registry)
 	{
-		// Don't overwrite a setting that was already setup.
-		UE_LOG(LogEasySettings, Error, TEXT("This FloatSetting was already setup. Setting TMap key was %s"), *TMapKey);
-	}
+		if (Registry.GetFloatSetting(Handle, OutSetting))
+		{
+			bOutSuccess = true;
+		}
+		else
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("GetFloatSettingByHandle() called with a handle that does not refer to a registered FloatSetting. Handle index was %d"), Handle.GetIndex());
+		}
+	});
 }
 
-void UEasySettingsStatics::GetFloatSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool& bOutSuccess, FFloatSetting& OutSetting)
+void UEasySettingsStatics::GetFloatSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, float& OutCurrent)
 {
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetFloatSettingValue);
+
 	bOutSuccess = false;
 
-	FString TMapKey = SettingID.GetTMapKey();
-	UEasySettingsSubsystem& SubSys = GetESSubsystem(WorldContextObject);
+	UEasySettingsRegistry::WithRegistry(TEXT("GetFloatSettingValue"), [&](UEasySettingsRegistry& Registry)
+	{
+		if (Registry.TryGetFloatValue(Handle, OutCurrent))
+		{
+			bOutSuccess = true;
+		}
+		else
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("GetFloatSettingValue() called with a handle that does not refer to a registered FloatSetting. Handle index was %d"), Handle.GetIndex());
+		}
+	});
+}
+
+void UEasySettingsStatics::UpdateFloatSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, float NewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateFloatSettingByHandle);
+
+	bOutSuccess = false;
 
-	if (SubSys.FloatSettings.Contains(TMapKey))
+	UEasySettingsRegistry::WithRegistry(TEXT("UpdateFloatSettingByHandle"), [&](UEasySettingsRegistry& Registry)
 	{
-		// We don't need to handle the possibility of someone changing this setting manually in the ini, as we are just referencing what is already in memory.
-		// The Setup function ensures what is in the ini falls within bounds prior to storing it in memory.
-		OutSetting = **SubSys.FloatSettings.Find(TMapKey);
-		bOutSuccess = true;
-	}
-	else
+		if (Registry.GetSettingType(Handle) == ESettingType::Float)
+		{
+			bOutSuccess = Registry.UpdateFloatSetting(Handle, NewCurrent);
+		}
+		else
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("UpdateFloatSettingByHandle() called with a handle that does not refer to a registered FloatSetting. Handle index was %d"), Handle.GetIndex());
+		}
+	});
+}
+
+void UEasySettingsStatics::SetupOpposingTogglesSetting(const UObject* WorldContextObject, FOpposingTogglesSetting& Setting, bool& bOutSuccess)
+{
+	FSettingHandle Handle;
+	SetupOpposingTogglesSettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
+
+void UEasySettingsStatics::SetupOpposingTogglesSettingWithHandle(const UObject* WorldContextObject, FOpposingTogglesSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupOpposingTogglesSettingWithHandle);
+
+	bOutSuccess = false;
+	OutHandle = FSettingHandle();
+	UEasySettingsRegistry::WithRegistry(TEXT("SetupOpposingTogglesSettingWithHandle"), [&](UEasySettingsRegistry& Registry)
 	{
-		// It was never registered through the Setup function, don't signal a success.
-		UE_LOG(LogEasySettings, Warning, TEXT("GetFloatSetting() called on a FloatSetting that was never registered with SetupFloatSetting(). Setting TMap key was %s"), *TMapKey);
-	}
+		OutHandle = Registry.SetupOpposingTogglesSetting(Setting);
+
+		// Either way, we should have a valid default value now, unless the key belongs to a setting of another type.
+		bOutSuccess = OutHandle.IsValid();
+	});
 }
 
-void UEasySettingsStatics::UpdateFloatSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, float NewCurrent, bool& bOutSuccess)
+void UEasySettingsStatics::GetOpposingTogglesSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool& bOutSuccess, FOpposingTogglesSetting& OutSetting)
 {
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetOpposingTogglesSetting);
+
 	bOutSuccess = false;
 
-	FString IniFileName = SettingID.GetIniFileName();
 	FString TMapKey = SettingID.GetTMapKey();
-	UEasySettingsSubsystem& SubSys = GetESSubsystem(WorldContextObject);
+	UEasySettingsRegistry::WithRegistry(TEXT("GetOpposingTogglesSetting"), [&](UEasySettingsRegistry& Registry)
+	{
+		// We don't need to handle the possibility of someone changing this setting manually in the ini file, as we are just referencing what is already in memory.
+		// The Setup function ensures what is in the ini file is valid prior to storing it in memory.
+		if (Registry.GetOpposingTogglesSetting(Registry.FindHandle(TMapKey), OutSetting))
+		{
+			bOutSuccess = true;
+		}
+		else
+		{
+			// It was never registered through the Setup function, don't signal a success.
+			UE_LOG(LogEasySettings, Warning, TEXT("GetOpposingTogglesSetting() called on an OpposingTogglesSetting that was never registered with SetupOpposingTogglesSetting(). Setting TMap key was %s"), *TMapKey);
+		}
+	});
+}
 
-	if (SubSys.FloatSettings.Contains(TMapKey))
+void UEasySettingsStatics::UpdateOpposingTogglesSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool bActivateFirst, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateOpposingTogglesSetting);
+
+	bOutSuccess = false;
+
+	FString TMapKey = SettingID.GetTMapKey();
+	UEasySettingsRegistry::WithRegistry(TEXT("UpdateOpposingTogglesSetting"), [&](UEasySettingsRegistry& Registry)
 	{
-		FFloatSetting* FoundFloatSetting = *SubSys.FloatSettings.Find(TMapKey);
-		if (FoundFloatSetting->ValidateFloatSetting(NewCurrent))
+		FSettingHandle Handle = Registry.FindHandle(TMapKey);
+		if (Registry.GetSettingType(Handle) == ESettingType::OpposingToggles)
 		{
-			// Make sure the new setting is actually different than the old.
-			if (FoundFloatSetting->Current == NewCurrent)
-			{
-				return;
-			}
+			bOutSuccess = Registry.UpdateOpposingTogglesSetting(Handle, bActivateFirst);
+		}
+		else
+		{
+			// This setting was never setup, don't signal a success.
+			UE_LOG(LogEasySettings, Warning, TEXT("UpdateOpposingTogglesSetting() called on a OpposingTogglesSetting that was never setup with SetupOpposingTogglesSetting(). Setting TMap key was %s"), *TMapKey);
+		}
+	});
+}
 
-			// Update the ini file.
-			GConfig->SetFloat(*FoundFloatSetting->Section, *FoundFloatSetting->Key, NewCurrent, IniFileName);
-			GConfig->Flush(false, IniFileName);
+void UEasySettingsStatics::GetOpposingTogglesSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FOpposingTogglesSetting& OutSetting)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetOpposingTogglesSettingByHandle);
 
-			// Update the TMap then let listeners know of the change.
-			FoundFloatSetting->Current = NewCurrent;
-			SubSys.FloatSettingChangedDelegate.Broadcast(SettingID, NewCurrent);
+	bOutSuccess = false;
 
-			// Successfully updated.
+	UEasySettingsRegistry::WithRegistry(TEXT("GetOpposingTogglesSettingByHandle"), [&](UEasySettingsRegistry& Registry)
+	{
+		if (Registry.GetOpposingTogglesSetting(Handle, OutSetting))
+		{
 			bOutSuccess = true;
 		}
 		else
 		{
-			UE_LOG(LogEasySettings, Warning, TEXT("UpdateFloatSetting() called on a FloatSetting that was outside the Min and Max values. Nothing was changed. Setting TMap key was %s"), *TMapKey);
+			UE_LOG(LogEasySettings, Warning, TEXT("GetOpposingTogglesSettingByHandle() called with a handle that does not refer to a registered OpposingTogglesSetting. Handle index was %d"), Handle.GetIndex());
 		}
-	}
-	else
-	{
-		// Either it was never setup, or it was out of bounds. We changed nothing.
-		UE_LOG(LogEasySettings, Warning, TEXT("UpdateFloatSetting() called on a FloatSetting that was never setup with SetupFloatSetting(). Setting TMap key was %s"), *TMapKey);
-	}
+	});
 }
 
-void UEasySettingsStatics::SetupOpposingTogglesSetting(const UObject* WorldContextObject, FOpposingTogglesSetting& Setting, bool& bOutSuccess)
+void UEasySettingsStatics::GetOpposingTogglesSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, bool& bOutFirstIsActive)
 {
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetOpposingTogglesSettingValue);
+
 	bOutSuccess = false;
 
-	FString IniFileName = Setting.GetIniFileName();
-	FString TMapKey = Setting.GetTMapKey();
-	UEasySettingsSubsystem& SubSys = GetESSubsystem(WorldContextObject);
+	UEasySettingsRegistry::WithRegistry(TEXT("GetOpposingTogglesSettingValue"), [&](UEasySettingsRegistry& Registry)
+	{
+		if (Registry.TryGetOpposingTogglesValue(Handle, bOutFirstIsActive))
+		{
+			bOutSuccess = true;
+		}
+		else
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("GetOpposingTogglesSettingValue() called with a handle that does not refer to a registered OpposingTogglesSetting. Handle index was %d"), Handle.GetIndex());
+		}
+	});
+}
+
+void UEasySettingsStatics::UpdateOpposingTogglesSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool bActivateFirst, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateOpposingTogglesSettingByHandle);
+
+	bOutSuccess = false;
 
-	// Check if the setting is in the config file yet.
-	FString StringReceived;
-	if (GConfig->GetString(*Setting.Section, *Setting.Key, StringReceived, IniFileName) && Setting.ParseOpposingToggleSetting(StringReceived))
+	UEasySettingsRegistry::WithRegistry(TEXT("UpdateOpposingTogglesSettingByHandle"), [&](UEasySettingsRegistry& Registry)
 	{
-		switch (Setting.ParseOpposingToggleSetting(StringReceived))
+		if (Registry.GetSettingType(Handle) == ESettingType::OpposingToggles)
 		{
-		case 1:
-			Setting.bFirstIsActive = true;
-			break;
-		case 2:
-			Setting.bFirstIsActive = false;
-			break;
+			bOutSuccess = Registry.UpdateOpposingTogglesSetting(Handle, bActivateFirst);
 		}
-	}
-	else
+		else
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("UpdateOpposingTogglesSettingByHandle() called with a handle that does not refer to a registered OpposingTogglesSetting. Handle index was %d"), Handle.GetIndex());
+		}
+	});
+}
+
+void UEasySettingsStatics::SetupEnumSetting(const UObject* WorldContextObject, FEnumSetting& Setting, bool& bOutSuccess)
+{
+	FSettingHandle Handle;
+	SetupEnumSettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
+
+void UEasySettingsStatics::SetupEnumSettingWithHandle(const UObject* WorldContextObject, FEnumSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupEnumSettingWithHandle);
+
+	bOutSuccess = false;
+	OutHandle = UEasySettingsRegistry::WithRegistry(TEXT("SetupEnumSettingWithHandle"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetupEnumSetting(Setting, bOutSuccess);
+	});
+}
+
+void UEasySettingsStatics::GetEnumSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FEnumSetting& OutSetting)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetEnumSettingByHandle);
+
+	bOutSuccess = false;
+
+	UEasySettingsRegistry::WithRegistry(TEXT("GetEnumSettingByHandle"), [&](UEasySettingsRegistry& Registry)
 	{
-		// The string we found in the ini file didn't match our FirstToggle or SecondToggle or wasn't there.
-		// Overwrite what is there, then print a warning.
-		if (Setting.bFirstIsDefault)
+		if (Registry.GetEnumSetting(Handle, OutSetting))
 		{
-			GConfig->SetString(*Setting.Section, *Setting.Key, *Setting.FirstToggle.ToLower(), IniFileName);
-			Setting.bFirstIsActive = true;
+			bOutSuccess = true;
 		}
 		else
 		{
-			GConfig->SetString(*Setting.Section, *Setting.Key, *Setting.SecondToggle.ToLower(), IniFileName);
-			Setting.bFirstIsActive = false;
+			UE_LOG(LogEasySettings, Warning, TEXT("GetEnumSettingByHandle() called with a handle that does not refer to a registered EnumSetting. Handle index was %d"), Handle.GetIndex());
 		}
-		GConfig->Flush(false, IniFileName);
-		UE_LOG(LogEasySettings, Warning, TEXT("Stored OpposingTogglesSettings did not match either the first or second toggles or was not present in the ini file. Overwriting with default. Setting TMap key was %s"), *TMapKey);
-	}
-	// Either way, we should have a valid default value now.
-	bOutSuccess = true;
+	});
+}
+
+void UEasySettingsStatics::GetEnumSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, int32& OutCurrent)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetEnumSettingValue);
 
-	if (!SubSys.OpposingTogglesSettings.Contains(TMapKey))
+	bOutSuccess = false;
+
+	UEasySettingsRegistry::WithRegistry(TEXT("GetEnumSettingValue"), [&](UEasySettingsRegistry& Registry)
 	{
-		SubSys.OpposingTogglesSettings.Add(TMapKey, &Setting);
-	}
-	else
+		if (Registry.TryGetEnumValue(Handle, OutCurrent))
+		{
+			bOutSuccess = true;
+		}
+		else
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("GetEnumSettingValue() called with a handle that does not refer to a registered EnumSetting. Handle index was %d"), Handle.GetIndex());
+		}
+	});
+}
+
+void UEasySettingsStatics::UpdateEnumSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, int32 NewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateEnumSettingByHandle);
+
+	bOutSuccess = false;
+
+	UEasySettingsRegistry::WithRegistry(TEXT("UpdateEnumSettingByHandle"), [&](UEasySettingsRegistry& Registry)
 	{
-		// Don't overwrite a setting that was already setup.
-		UE_LOG(LogEasySettings, Error, TEXT("This OpposingTogglesSettings was already setup. Setting TMap key was %s"), *TMapKey);
-	}
+		if (Registry.GetSettingType(Handle) == ESettingType::Enum)
+		{
+			bOutSuccess = Registry.UpdateEnumSetting(Handle, NewCurrent);
+		}
+		else
+		{
+			UE_LOG(LogEasySettings, Warning, TEXT("UpdateEnumSettingByHandle() called with a handle that does not refer to a registered EnumSetting. Handle index was %d"), Handle.GetIndex());
+		}
+	});
 }
 
-void UEasySettingsStatics::GetOpposingTogglesSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool& bOutSuccess, FOpposingTogglesSetting& OutSetting)
+void UEasySettingsStatics::SetupIntSetting(const UObject* WorldContextObject, FIntSetting& Setting, bool& bOutSuccess)
 {
+	FSettingHandle Handle;
+	SetupIntSettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
+
+void UEasySettingsStatics::SetupIntSettingWithHandle(const UObject* WorldContextObject, FIntSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupIntSettingWithHandle);
+
 	bOutSuccess = false;
+	OutHandle = UEasySettingsRegistry::WithRegistry(TEXT("SetupIntSettingWithHandle"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetupSetting(Setting, bOutSuccess);
+	});
+}
 
-	FString TMapKey = SettingID.GetTMapKey();
-	UEasySettingsSubsystem& SubSys = GetESSubsystem(WorldContextObject);
+void UEasySettingsStatics::GetIntSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, int32& OutCurrent)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetIntSettingValue);
 
-	if (SubSys.OpposingTogglesSettings.Contains(TMapKey))
+	bOutSuccess = EasySettingsStatics::GetSettingValue<FIntSetting>(Handle, OutCurrent, TEXT("GetIntSettingValue"));
+}
+
+void UEasySettingsStatics::UpdateIntSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, int32 NewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateIntSettingByHandle);
+
+	bOutSuccess = EasySettingsStatics::UpdateSettingByHandle<FIntSetting>(Handle, NewCurrent, TEXT("UpdateIntSettingByHandle"));
+}
+
+void UEasySettingsStatics::SetupBoolSetting(const UObject* WorldContextObject, FBoolSetting& Setting, bool& bOutSuccess)
+{
+	FSettingHandle Handle;
+	SetupBoolSettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
+
+void UEasySettingsStatics::SetupBoolSettingWithHandle(const UObject* WorldContextObject, FBoolSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupBoolSettingWithHandle);
+
+	bOutSuccess = false;
+	OutHandle = UEasySettingsRegistry::WithRegistry(TEXT("SetupBoolSettingWithHandle"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
 	{
-		// We don't need to handle the possibility of someone changing this setting manually in the ini file, as we are just referencing what is already in memory.
-		// The Setup function ensures what is in the ini file is valid prior to storing it in memory.
-		OutSetting = **SubSys.OpposingTogglesSettings.Find(TMapKey);
-		bOutSuccess = true;
-	}
-	else
+		return Registry.SetupSetting(Setting, bOutSuccess);
+	});
+}
+
+void UEasySettingsStatics::GetBoolSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, bool& bOutCurrent)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetBoolSettingValue);
+
+	bOutSuccess = EasySettingsStatics::GetSettingValue<FBoolSetting>(Handle, bOutCurrent, TEXT("GetBoolSettingValue"));
+}
+
+void UEasySettingsStatics::UpdateBoolSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool bNewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateBoolSettingByHandle);
+
+	bOutSuccess = EasySettingsStatics::UpdateSettingByHandle<FBoolSetting>(Handle, bNewCurrent, TEXT("UpdateBoolSettingByHandle"));
+}
+
+void UEasySettingsStatics::SetupVector2DSetting(const UObject* WorldContextObject, FVector2DSetting& Setting, bool& bOutSuccess)
+{
+	FSettingHandle Handle;
+	SetupVector2DSettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
+
+void UEasySettingsStatics::SetupVector2DSettingWithHandle(const UObject* WorldContextObject, FVector2DSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupVector2DSettingWithHandle);
+
+	bOutSuccess = false;
+	OutHandle = UEasySettingsRegistry::WithRegistry(TEXT("SetupVector2DSettingWithHandle"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
 	{
-		// It was never registered through the Setup function, don't signal a success.
-		UE_LOG(LogEasySettings, Warning, TEXT("GetOpposingTogglesSetting() called on an OpposingTogglesSetting that was never registered with SetupOpposingTogglesSetting(). Setting TMap key was %s"), *TMapKey);
-	}
+		return Registry.SetupSetting(Setting, bOutSuccess);
+	});
 }
 
-void UEasySettingsStatics::UpdateOpposingTogglesSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool bActivateFirst, bool& bOutSuccess)
+void UEasySettingsStatics::GetVector2DSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FVector2D& OutCurrent)
 {
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetVector2DSettingValue);
+
+	bOutSuccess = EasySettingsStatics::GetSettingValue<FVector2DSetting>(Handle, OutCurrent, TEXT("GetVector2DSettingValue"));
+}
+
+void UEasySettingsStatics::UpdateVector2DSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, const FVector2D& NewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateVector2DSettingByHandle);
+
+	bOutSuccess = EasySettingsStatics::UpdateSettingByHandle<FVector2DSetting>(Handle, NewCurrent, TEXT("UpdateVector2DSettingByHandle"));
+}
+
+void UEasySettingsStatics::SetupLinearColorSetting(const UObject* WorldContextObject, FLinearColorSetting& Setting, bool& bOutSuccess)
+{
+	FSettingHandle Handle;
+	SetupLinearColorSettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
+
+void UEasySettingsStatics::SetupLinearColorSettingWithHandle(const UObject* WorldContextObject, FLinearColorSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupLinearColorSettingWithHandle);
+
 	bOutSuccess = false;
+	OutHandle = UEasySettingsRegistry::WithRegistry(TEXT("SetupLinearColorSettingWithHandle"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetupSetting(Setting, bOutSuccess);
+	});
+}
 
-	FString IniFileName = SettingID.GetIniFileName();
-	FString TMapKey = SettingID.GetTMapKey();
-	UEasySettingsSubsystem& SubSys = GetESSubsystem(WorldContextObject);
+void UEasySettingsStatics::GetLinearColorSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FLinearColor& OutCurrent)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetLinearColorSettingValue);
 
-	if (SubSys.OpposingTogglesSettings.Contains(TMapKey))
+	bOutSuccess = EasySettingsStatics::GetSettingValue<FLinearColorSetting>(Handle, OutCurrent, TEXT("GetLinearColorSettingValue"));
+}
+
+void UEasySettingsStatics::UpdateLinearColorSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, const FLinearColor& NewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateLinearColorSettingByHandle);
+
+	bOutSuccess = EasySettingsStatics::UpdateSettingByHandle<FLinearColorSetting>(Handle, NewCurrent, TEXT("UpdateLinearColorSettingByHandle"));
+}
+
+void UEasySettingsStatics::SetupKeySetting(const UObject* WorldContextObject, FKeySetting& Setting, bool& bOutSuccess)
+{
+	FSettingHandle Handle;
+	SetupKeySettingWithHandle(WorldContextObject, Setting, bOutSuccess, Handle);
+}
+
+void UEasySettingsStatics::SetupKeySettingWithHandle(const UObject* WorldContextObject, FKeySetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_SetupKeySettingWithHandle);
+
+	bOutSuccess = false;
+	OutHandle = UEasySettingsRegistry::WithRegistry(TEXT("SetupKeySettingWithHandle"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
 	{
-		FOpposingTogglesSetting* FoundOpposingToggle = *SubSys.OpposingTogglesSettings.Find(TMapKey);
-		// Make sure the new setting is actually different than the old.
-		if (FoundOpposingToggle->bFirstIsActive != bActivateFirst)
-		{
-			// Update the ini file.
-			FString NewActive;
-			if (bActivateFirst)
-			{
-				NewActive = FoundOpposingToggle->FirstToggle;
-			}
-			else
-			{
-				NewActive = FoundOpposingToggle->SecondToggle;
-			}
+		return Registry.SetupSetting(Setting, bOutSuccess);
+	});
+}
 
-			GConfig->SetString(*FoundOpposingToggle->Section, *FoundOpposingToggle->Key, *NewActive.ToLower(), IniFileName);
-			GConfig->Flush(false, IniFileName);
+void UEasySettingsStatics::GetKeySettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FKey& OutCurrent)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_GetKeySettingValue);
 
-			// Update the TMap then let listeners know of the change.
-			FoundOpposingToggle->bFirstIsActive = bActivateFirst;
-			SubSys.OpposingTogglesSettingChangedDelegate.Broadcast(SettingID, bActivateFirst);
+	bOutSuccess = EasySettingsStatics::GetSettingValue<FKeySetting>(Handle, OutCurrent, TEXT("GetKeySettingValue"));
+}
 
-			bOutSuccess = true;
-		}
-	}
-	else
+void UEasySettingsStatics::UpdateKeySettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, const FKey& NewCurrent, bool& bOutSuccess)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_UpdateKeySettingByHandle);
+
+	bOutSuccess = EasySettingsStatics::UpdateSettingByHandle<FKeySetting>(Handle, NewCurrent, TEXT("UpdateKeySettingByHandle"));
+}
+
+void UEasySettingsStatics::RegisterSettings(const UObject* WorldContextObject, const UEasySettingsSchema* Schema, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+	FEasySettingsGenericHandles& OutGenericHandles)
+{
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_RegisterSettings);
+
+	OutFloatHandles.Reset();
+	OutOpposingTogglesHandles.Reset();
+	OutEnumHandles.Reset();
+	OutGenericHandles = FEasySettingsGenericHandles();
+	UEasySettingsRegistry::WithRegistry(TEXT("RegisterSettings"), [&](UEasySettingsRegistry& Registry)
 	{
-		// This setting was never setup, don't signal a success.
-		UE_LOG(LogEasySettings, Warning, TEXT("UpdateOpposingTogglesSetting() called on a OpposingTogglesSetting that was never setup with SetupOpposingTogglesSetting(). Setting TMap key was %s"), *TMapKey);
-	}
+		Registry.RegisterSettings(Schema, OutFloatHandles, OutOpposingTogglesHandles, OutEnumHandles, OutGenericHandles);
+	});
 }
 
-UEasySettingsSubsystem& UEasySettingsStatics::GetESSubsystem(const UObject* WorldContextObject)
+void UEasySettingsStatics::ReleaseSetting(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess)
 {
-	UGameInstance* GI = UGameplayStatics::GetGameInstance(WorldContextObject);
-	return *GI->GetSubsystem<UEasySettingsSubsystem>();
+	EASYSETTINGS_TRACE_SCOPE(UEasySettingsStatics_ReleaseSetting);
+
+	bOutSuccess = UEasySettingsRegistry::WithRegistry(TEXT("ReleaseSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.ReleaseSetting(Handle);
+	});
 }
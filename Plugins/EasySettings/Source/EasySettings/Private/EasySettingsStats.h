@@ -0,0 +1,59 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/**
+ * Stats and Unreal Insights instrumentation for the EasySettings hot paths. View the stats with "stat EasySettings", and enable the trace channel
+ * with -trace=cpu,EasySettings to see which setting or ini file a Setup, Update or flush belonged to. Both compile out in shipping builds.
+ */
+
+DECLARE_STATS_GROUP(TEXT("EasySettings"), STATGROUP_EasySettings, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Setup"), STAT_EasySettings_Setup, STATGROUP_EasySettings, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Get"), STAT_EasySettings_Get, STATGROUP_EasySettings, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update"), STAT_EasySettings_Update, STATGROUP_EasySettings, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GConfig Read"), STAT_EasySettings_ConfigRead, STATGROUP_EasySettings, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GConfig Write"), STAT_EasySettings_ConfigWrite, STATGROUP_EasySettings, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flush"), STAT_EasySettings_Flush, STATGROUP_EasySettings, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Broadcast"), STAT_EasySettings_Broadcast, STATGROUP_EasySettings, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Flushes"), STAT_EasySettings_Flushes, STATGROUP_EasySettings, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Flushed"), STAT_EasySettings_BytesFlushed, STATGROUP_EasySettings, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Listeners Notified"), STAT_EasySettings_ListenersNotified, STATGROUP_EasySettings, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lookup Misses"), STAT_EasySettings_LookupMisses, STATGROUP_EasySettings, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Notifications Coalesced"), STAT_EasySettings_NotificationsCoalesced, STATGROUP_EasySettings, );
+
+#define EASYSETTINGS_TRACE_ENABLED (CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if EASYSETTINGS_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(EasySettingsChannel);
+
+TRACE_DECLARE_MEMORY_COUNTER_EXTERN(EasySettings_BytesFlushed);
+
+/** Insights scope with a fixed name. */
+#define EASYSETTINGS_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, EasySettingsChannel)
+
+/** Insights scope named after a setting or ini file. Text is only read while the channel is enabled. */
+#define EASYSETTINGS_TRACE_SCOPE_TEXT(Text) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(Text, EasySettingsChannel)
+
+#define EASYSETTINGS_TRACE_BYTES_FLUSHED(Bytes) TRACE_COUNTER_ADD(EasySettings_BytesFlushed, Bytes)
+
+#else
+
+#define EASYSETTINGS_TRACE_SCOPE(Name)
+#define EASYSETTINGS_TRACE_SCOPE_TEXT(Text)
+#define EASYSETTINGS_TRACE_BYTES_FLUSHED(Bytes)
+
+#endif
+
+/** Cycle counter that also shows up in Insights under the EasySettings channel. */
+#define EASYSETTINGS_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	EASYSETTINGS_TRACE_SCOPE(Stat)
@@ -1,13 +1,542 @@
 // Copyright Nathan Ralph. All Rights Reserved.
 
 #include "EasySettingsSubsystem.h"
+#include "EasySettingsRegistry.h"
+
+namespace EasySettingsSubsystem
+{
+	/**
+	 * Shared by the GetPending<Type>Value functions of every generic setting type.
+	 * @param Fallback	Returned when bOutSuccess is false, as some value types aren't initialized by their default constructor.
+	 */
+	template <typename SettingType>
+	static typename TSettingTraits<SettingType>::ValueType GetPendingValue(FSettingHandle Handle, bool& bOutSuccess, const typename TSettingTraits<SettingType>::ValueType& Fallback, const TCHAR* FunctionName)
+	{
+		bOutSuccess = false;
+		return UEasySettingsRegistry::WithRegistry(FunctionName, Fallback, [Handle, &Fallback, &bOutSuccess](UEasySettingsRegistry& Registry)
+		{
+			typename TSettingTraits<SettingType>::ValueType Pending = Fallback;
+			bOutSuccess = Registry.TryGetPendingValue<SettingType>(Handle, Pending);
+			return Pending;
+		});
+	}
+}
 
 void UEasySettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::Initialize"), [this](UEasySettingsRegistry& Registry)
+	{
+		Registry.FloatSettingChangedDelegate.AddDynamic(this, &UEasySettingsSubsystem::HandleFloatSettingChanged);
+		Registry.OpposingTogglesSettingChangedDelegate.AddDynamic(this, &UEasySettingsSubsystem::HandleOpposingTogglesSettingChanged);
+		Registry.EnumSettingChangedDelegate.AddDynamic(this, &UEasySettingsSubsystem::HandleEnumSettingChanged);
+		Registry.SettingChangedDelegate.AddDynamic(this, &UEasySettingsSubsystem::HandleSettingChanged);
+		Registry.SettingsCommittedDelegate.AddDynamic(this, &UEasySettingsSubsystem::HandleSettingsCommitted);
+	});
 }
 
 void UEasySettingsSubsystem::Deinitialize()
 {
+	// The registry outlives every GameInstance, except when the engine is shutting down.
+	if (UEasySettingsRegistry* Registry = UEasySettingsRegistry::TryGet())
+	{
+		Registry->FloatSettingChangedDelegate.RemoveAll(this);
+		Registry->OpposingTogglesSettingChangedDelegate.RemoveAll(this);
+		Registry->EnumSettingChangedDelegate.RemoveAll(this);
+		Registry->SettingChangedDelegate.RemoveAll(this);
+		Registry->SettingsCommittedDelegate.RemoveAll(this);
+	}
+
 	Super::Deinitialize();
 }
+
+void UEasySettingsSubsystem::RegisterSettings(const UEasySettingsSchema* Schema, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+	FEasySettingsGenericHandles& OutGenericHandles)
+{
+	OutFloatHandles.Reset();
+	OutOpposingTogglesHandles.Reset();
+	OutEnumHandles.Reset();
+	OutGenericHandles = FEasySettingsGenericHandles();
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::RegisterSettings"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.RegisterSettings(Schema, OutFloatHandles, OutOpposingTogglesHandles, OutEnumHandles, OutGenericHandles);
+	});
+}
+
+bool UEasySettingsSubsystem::BindToSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::BindToSettingChanged"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.BindToSettingChanged(Handle, Event);
+	});
+}
+
+void UEasySettingsSubsystem::UnbindFromSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event)
+{
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::UnbindFromSettingChanged"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.UnbindFromSettingChanged(Handle, Event);
+	});
+}
+
+bool UEasySettingsSubsystem::SetNotifyOnEveryChange(FSettingHandle Handle, bool bEveryChange)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetNotifyOnEveryChange"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetNotifyOnEveryChange(Handle, bEveryChange);
+	});
+}
+
+void UEasySettingsSubsystem::FlushPendingNotifications()
+{
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::FlushPendingNotifications"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.FlushPendingNotifications();
+	});
+}
+
+bool UEasySettingsSubsystem::BindPropertyToSetting(FSettingHandle Handle, UObject* Object, FName PropertyName)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::BindPropertyToSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.BindPropertyToSetting(Handle, Object, PropertyName);
+	});
+}
+
+void UEasySettingsSubsystem::UnbindObjectFromSetting(FSettingHandle Handle, UObject* Object)
+{
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::UnbindObjectFromSetting"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.UnbindObjectFromSetting(Handle, Object);
+	});
+}
+
+bool UEasySettingsSubsystem::BeginTransaction()
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::BeginTransaction"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.BeginTransaction();
+	});
+}
+
+bool UEasySettingsSubsystem::StageFloatSetting(FSettingHandle Handle, float NewCurrent)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageFloatSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageFloatSetting(Handle, NewCurrent);
+	});
+}
+
+bool UEasySettingsSubsystem::StageOpposingTogglesSetting(FSettingHandle Handle, bool bActivateFirst)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageOpposingTogglesSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageOpposingTogglesSetting(Handle, bActivateFirst);
+	});
+}
+
+bool UEasySettingsSubsystem::StageEnumSetting(FSettingHandle Handle, int32 NewCurrent)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageEnumSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageEnumSetting(Handle, NewCurrent);
+	});
+}
+
+bool UEasySettingsSubsystem::StageIntSetting(FSettingHandle Handle, int32 NewCurrent)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageIntSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageSetting<FIntSetting>(Handle, NewCurrent);
+	});
+}
+
+bool UEasySettingsSubsystem::StageBoolSetting(FSettingHandle Handle, bool bNewCurrent)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageBoolSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageSetting<FBoolSetting>(Handle, bNewCurrent);
+	});
+}
+
+bool UEasySettingsSubsystem::StageVector2DSetting(FSettingHandle Handle, const FVector2D& NewCurrent)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageVector2DSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageSetting<FVector2DSetting>(Handle, NewCurrent);
+	});
+}
+
+bool UEasySettingsSubsystem::StageLinearColorSetting(FSettingHandle Handle, const FLinearColor& NewCurrent)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageLinearColorSetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageSetting<FLinearColorSetting>(Handle, NewCurrent);
+	});
+}
+
+bool UEasySettingsSubsystem::StageKeySetting(FSettingHandle Handle, const FKey& NewCurrent)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::StageKeySetting"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.StageSetting<FKeySetting>(Handle, NewCurrent);
+	});
+}
+
+bool UEasySettingsSubsystem::CommitTransaction(TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::CommitTransaction"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.CommitTransaction(OutChangedHandles);
+	});
+}
+
+void UEasySettingsSubsystem::RollbackTransaction()
+{
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::RollbackTransaction"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.RollbackTransaction();
+	});
+}
+
+bool UEasySettingsSubsystem::IsTransactionOpen() const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::IsTransactionOpen"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.IsTransactionOpen();
+	});
+}
+
+bool UEasySettingsSubsystem::ApplyPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::ApplyPreset"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.ApplyPreset(Preset, OutChangedHandles);
+	});
+}
+
+bool UEasySettingsSubsystem::PreviewPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::PreviewPreset"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.PreviewPreset(Preset, OutChangedHandles);
+	});
+}
+
+void UEasySettingsSubsystem::RevertPreview(TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::RevertPreview"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.RevertPreview(OutChangedHandles);
+	});
+}
+
+bool UEasySettingsSubsystem::IsPreviewingPreset() const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::IsPreviewingPreset"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.IsPreviewingPreset();
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingFloatValue(FSettingHandle Handle, float NewPending)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingFloatValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingFloatValue(Handle, NewPending);
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingOpposingTogglesValue(FSettingHandle Handle, bool bActivateFirst)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingOpposingTogglesValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingOpposingTogglesValue(Handle, bActivateFirst);
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingEnumValue(FSettingHandle Handle, int32 NewPending)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingEnumValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingEnumValue(Handle, NewPending);
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingIntValue(FSettingHandle Handle, int32 NewPending)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingIntValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingValue<FIntSetting>(Handle, NewPending);
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingBoolValue(FSettingHandle Handle, bool bNewPending)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingBoolValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingValue<FBoolSetting>(Handle, bNewPending);
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingVector2DValue(FSettingHandle Handle, const FVector2D& NewPending)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingVector2DValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingValue<FVector2DSetting>(Handle, NewPending);
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingLinearColorValue(FSettingHandle Handle, const FLinearColor& NewPending)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingLinearColorValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingValue<FLinearColorSetting>(Handle, NewPending);
+	});
+}
+
+bool UEasySettingsSubsystem::SetPendingKeyValue(FSettingHandle Handle, const FKey& NewPending)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetPendingKeyValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetPendingValue<FKeySetting>(Handle, NewPending);
+	});
+}
+
+float UEasySettingsSubsystem::GetPendingFloatValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	bOutSuccess = false;
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::GetPendingFloatValue"), 0.f, [&](UEasySettingsRegistry& Registry)
+	{
+		float Pending = 0.f;
+		bOutSuccess = Registry.TryGetPendingFloatValue(Handle, Pending);
+		return Pending;
+	});
+}
+
+bool UEasySettingsSubsystem::GetPendingOpposingTogglesValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	bOutSuccess = false;
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::GetPendingOpposingTogglesValue"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		bool bFirstIsActive = false;
+		bOutSuccess = Registry.TryGetPendingOpposingTogglesValue(Handle, bFirstIsActive);
+		return bFirstIsActive;
+	});
+}
+
+int32 UEasySettingsSubsystem::GetPendingEnumValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	bOutSuccess = false;
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::GetPendingEnumValue"), INDEX_NONE, [&](UEasySettingsRegistry& Registry)
+	{
+		int32 Pending = INDEX_NONE;
+		bOutSuccess = Registry.TryGetPendingEnumValue(Handle, Pending);
+		return Pending;
+	});
+}
+
+int32 UEasySettingsSubsystem::GetPendingIntValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	return EasySettingsSubsystem::GetPendingValue<FIntSetting>(Handle, bOutSuccess, 0, TEXT("UEasySettingsSubsystem::GetPendingIntValue"));
+}
+
+bool UEasySettingsSubsystem::GetPendingBoolValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	return EasySettingsSubsystem::GetPendingValue<FBoolSetting>(Handle, bOutSuccess, false, TEXT("UEasySettingsSubsystem::GetPendingBoolValue"));
+}
+
+FVector2D UEasySettingsSubsystem::GetPendingVector2DValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	return EasySettingsSubsystem::GetPendingValue<FVector2DSetting>(Handle, bOutSuccess, FVector2D::ZeroVector, TEXT("UEasySettingsSubsystem::GetPendingVector2DValue"));
+}
+
+FLinearColor UEasySettingsSubsystem::GetPendingLinearColorValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	return EasySettingsSubsystem::GetPendingValue<FLinearColorSetting>(Handle, bOutSuccess, FLinearColor::Black, TEXT("UEasySettingsSubsystem::GetPendingLinearColorValue"));
+}
+
+FKey UEasySettingsSubsystem::GetPendingKeyValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	return EasySettingsSubsystem::GetPendingValue<FKeySetting>(Handle, bOutSuccess, EKeys::Invalid, TEXT("UEasySettingsSubsystem::GetPendingKeyValue"));
+}
+
+bool UEasySettingsSubsystem::HasPendingChange(FSettingHandle Handle) const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::HasPendingChange"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.HasPendingChange(Handle);
+	});
+}
+
+bool UEasySettingsSubsystem::IsPendingValueDefault(FSettingHandle Handle) const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::IsPendingValueDefault"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.IsPendingValueDefault(Handle);
+	});
+}
+
+bool UEasySettingsSubsystem::HasAnyPendingChanges() const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::HasAnyPendingChanges"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.HasAnyPendingChanges();
+	});
+}
+
+bool UEasySettingsSubsystem::HasAnyNonDefaultSettings() const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::HasAnyNonDefaultSettings"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.HasAnyNonDefaultSettings();
+	});
+}
+
+bool UEasySettingsSubsystem::ApplyAll(TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::ApplyAll"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.ApplyAll(OutChangedHandles);
+	});
+}
+
+void UEasySettingsSubsystem::RevertAll()
+{
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::RevertAll"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.RevertAll();
+	});
+}
+
+void UEasySettingsSubsystem::ResetAllToDefault()
+{
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::ResetAllToDefault"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.ResetAllToDefault();
+	});
+}
+
+bool UEasySettingsSubsystem::CreateProfile(FName ProfileName, FName ParentProfile)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::CreateProfile"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.CreateProfile(ProfileName, ParentProfile);
+	});
+}
+
+bool UEasySettingsSubsystem::CopyProfile(FName SourceProfile, FName NewProfile)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::CopyProfile"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.CopyProfile(SourceProfile, NewProfile);
+	});
+}
+
+bool UEasySettingsSubsystem::DeleteProfile(FName ProfileName)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::DeleteProfile"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.DeleteProfile(ProfileName);
+	});
+}
+
+bool UEasySettingsSubsystem::SetActiveProfile(FName ProfileName, TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::SetActiveProfile"), false, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.SetActiveProfile(ProfileName, OutChangedHandles);
+	});
+}
+
+FName UEasySettingsSubsystem::GetActiveProfile() const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::GetActiveProfile"), NAME_None, [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.GetActiveProfile();
+	});
+}
+
+FSettingHandle UEasySettingsSubsystem::RegisterDerivedSetting(FName Name, const TArray<FSettingHandle>& Inputs, FDerivedSettingDynamicFunction Function)
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::RegisterDerivedSetting"), FSettingHandle(), [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.RegisterDerivedSetting(Name, Inputs, Function);
+	});
+}
+
+float UEasySettingsSubsystem::GetDerivedValue(FSettingHandle Handle, bool& bOutSuccess) const
+{
+	bOutSuccess = false;
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::GetDerivedValue"), 0.f, [&](UEasySettingsRegistry& Registry)
+	{
+		float Value = 0.f;
+		bOutSuccess = Registry.TryGetDerivedValue(Handle, Value);
+		return Value;
+	});
+}
+
+void UEasySettingsSubsystem::ReloadFromConfig(EIniFile IniFile, TArray<FSettingHandle>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::ReloadFromConfig"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.ReloadFromConfig(IniFile, OutChangedHandles);
+	});
+}
+
+void UEasySettingsSubsystem::FlushDirtyIniFiles()
+{
+	UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::FlushDirtyIniFiles"), [&](UEasySettingsRegistry& Registry)
+	{
+		Registry.FlushDirtyIniFiles();
+	});
+}
+
+FEasySettingsPersistenceStats UEasySettingsSubsystem::GetPersistenceStats() const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::GetPersistenceStats"), FEasySettingsPersistenceStats(), [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.GetPersistenceStats();
+	});
+}
+
+FEasySettingsMemoryStats UEasySettingsSubsystem::GetMemoryStats() const
+{
+	return UEasySettingsRegistry::WithRegistry(TEXT("UEasySettingsSubsystem::GetMemoryStats"), FEasySettingsMemoryStats(), [&](UEasySettingsRegistry& Registry)
+	{
+		return Registry.GetMemoryStats();
+	});
+}
+
+void UEasySettingsSubsystem::HandleFloatSettingChanged(FSettingBase SettingID, float NewCurrent)
+{
+	FloatSettingChangedDelegate.Broadcast(SettingID, NewCurrent);
+}
+
+void UEasySettingsSubsystem::HandleOpposingTogglesSettingChanged(FSettingBase SettingID, bool bNewFirstIsActive)
+{
+	OpposingTogglesSettingChangedDelegate.Broadcast(SettingID, bNewFirstIsActive);
+}
+
+void UEasySettingsSubsystem::HandleEnumSettingChanged(FSettingBase SettingID, int32 NewCurrent)
+{
+	EnumSettingChangedDelegate.Broadcast(SettingID, NewCurrent);
+}
+
+void UEasySettingsSubsystem::HandleSettingChanged(FSettingBase SettingID, FSettingHandle Handle)
+{
+	SettingChangedDelegate.Broadcast(SettingID, Handle);
+}
+
+void UEasySettingsSubsystem::HandleSettingsCommitted(const TArray<FSettingHandle>& ChangedHandles)
+{
+	SettingsCommittedDelegate.Broadcast(ChangedHandles);
+}
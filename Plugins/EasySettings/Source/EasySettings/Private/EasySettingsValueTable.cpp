@@ -0,0 +1,140 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsValueTable.h"
+#include "EasySettings.h"
+
+FEasySettingsValueTable::FEasySettingsValueTable()
+{
+	for (std::atomic<FPage*>& Page : Pages)
+	{
+		Page.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FEasySettingsValueTable::~FEasySettingsValueTable()
+{
+	for (std::atomic<FPage*>& Page : Pages)
+	{
+		delete Page.load(std::memory_order_relaxed);
+	}
+}
+
+void FEasySettingsValueTable::PublishFloat(FSettingHandle Handle, float Value)
+{
+	uint32 ValueBits;
+	FMemory::Memcpy(&ValueBits, &Value, sizeof(ValueBits));
+	Publish(Handle, ValueBits);
+}
+
+void FEasySettingsValueTable::PublishBool(FSettingHandle Handle, bool bValue)
+{
+	Publish(Handle, bValue ? 1 : 0);
+}
+
+void FEasySettingsValueTable::PublishInt(FSettingHandle Handle, int32 Value)
+{
+	Publish(Handle, uint32(Value));
+}
+
+void FEasySettingsValueTable::Retire(FSettingHandle Handle)
+{
+	check(IsInGameThread());
+
+	const int32 Index = Handle.GetIndex();
+	if (Index < 0 || Index >= PageSize * MaxPages)
+	{
+		return;
+	}
+
+	if (FPage* Page = Pages[Index / PageSize].load(std::memory_order_relaxed))
+	{
+		Page->Entries[Index % PageSize].store(0, std::memory_order_release);
+	}
+}
+
+bool FEasySettingsValueTable::TryReadFloat(FSettingHandle Handle, float& OutValue) const
+{
+	uint32 ValueBits;
+	if (!TryRead(Handle, ValueBits))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(&OutValue, &ValueBits, sizeof(OutValue));
+	return true;
+}
+
+bool FEasySettingsValueTable::TryReadBool(FSettingHandle Handle, bool& bOutValue) const
+{
+	uint32 ValueBits;
+	if (!TryRead(Handle, ValueBits))
+	{
+		return false;
+	}
+
+	bOutValue = ValueBits != 0;
+	return true;
+}
+
+bool FEasySettingsValueTable::TryReadInt(FSettingHandle Handle, int32& OutValue) const
+{
+	uint32 ValueBits;
+	if (!TryRead(Handle, ValueBits))
+	{
+		return false;
+	}
+
+	OutValue = int32(ValueBits);
+	return true;
+}
+
+void FEasySettingsValueTable::Publish(FSettingHandle Handle, uint32 ValueBits)
+{
+	check(IsInGameThread());
+
+	const int32 Index = Handle.GetIndex();
+	if (Index < 0 || Index >= PageSize * MaxPages)
+	{
+		UE_LOG(LogEasySettings, Error, TEXT("Setting handle index %d does not fit in the value table, it will not be readable from other threads."), Index);
+		return;
+	}
+
+	std::atomic<FPage*>& PageSlot = Pages[Index / PageSize];
+	FPage* Page = PageSlot.load(std::memory_order_relaxed);
+	if (!Page)
+	{
+		// Only the game thread allocates pages, so there is no race to resolve. Readers see the page once it is fully zeroed.
+		Page = new FPage();
+		for (std::atomic<uint64>& Entry : Page->Entries)
+		{
+			Entry.store(0, std::memory_order_relaxed);
+		}
+		PageSlot.store(Page, std::memory_order_release);
+	}
+
+	Page->Entries[Index % PageSize].store(PackEntry(Handle.GetGeneration(), ValueBits), std::memory_order_release);
+}
+
+bool FEasySettingsValueTable::TryRead(FSettingHandle Handle, uint32& OutValueBits) const
+{
+	const int32 Index = Handle.GetIndex();
+	if (Index < 0 || Index >= PageSize * MaxPages)
+	{
+		return false;
+	}
+
+	const FPage* Page = Pages[Index / PageSize].load(std::memory_order_acquire);
+	if (!Page)
+	{
+		return false;
+	}
+
+	const uint64 Entry = Page->Entries[Index % PageSize].load(std::memory_order_acquire);
+	if ((Entry >> 32) != uint64(uint32(Handle.GetGeneration()) + 1))
+	{
+		return false;
+	}
+
+	OutValueBits = uint32(Entry);
+	return true;
+}
@@ -0,0 +1,40 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsBench.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasySettingsBenchTest, "EasySettings.Bench",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FEasySettingsBenchTest::RunTest(const FString& Parameters)
+{
+	const int32 SettingCounts[] = { 10, 1000, 10000 };
+	const TArray<EasySettingsBench::FResult> Results = EasySettingsBench::Run(SettingCounts);
+
+	for (const EasySettingsBench::FResult& Result : Results)
+	{
+		const FString What = FString::Printf(TEXT("%s with %d settings"), *Result.Operation, Result.NumSettings);
+		TestEqual(What + TEXT(" made a call per setting"), Result.Latencies.Num(), Result.NumSettings);
+		TestTrue(What + TEXT(" has ordered percentiles"), Result.GetPercentile(0.5) <= Result.GetPercentile(0.99));
+	}
+
+	const FString Csv = EasySettingsBench::ToCsv(Results);
+	TArray<FString> Rows;
+	Csv.ParseIntoArrayLines(Rows);
+	for (const FString& Row : Rows)
+	{
+		AddInfo(Row);
+	}
+
+	// Kept next to the commandlet's results, so regressions can be tracked from automation runs too.
+	const FString OutputFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasySettingsBench"), TEXT("AutomationResults.csv"));
+	TestTrue(TEXT("Results written to ") + OutputFile, FFileHelper::SaveStringToFile(Csv, *OutputFile));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,144 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#include "EasySettingsValueTable.h"
+#include "Async/Async.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace EasySettingsValueTableTests
+{
+	/** Spans two full pages and part of a third, so readers race with pages being allocated. */
+	static constexpr int32 NumSettings = FEasySettingsValueTable::PageSize * 2 + 7;
+
+	static constexpr int32 NumReaders = 8;
+
+	static constexpr int32 NumWriterPasses = 2000;
+
+	/** Every setting retires its handle and publishes under the next generation once every RetireInterval passes. */
+	static constexpr int32 RetireInterval = 7;
+
+	/** Even settings are published as floats, odd ones as ints. Both encode the generation they were published under. */
+	static bool IsFloatSetting(int32 Index) { return Index % 2 == 0; }
+
+	static int32 EncodeInt(int32 Generation, int32 Pass) { return (Generation << 16) | (Pass & 0xFFFF); }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasySettingsValueTableConcurrentReadTest, "EasySettings.ValueTable.ConcurrentReads",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FEasySettingsValueTableConcurrentReadTest::RunTest(const FString& Parameters)
+{
+	using namespace EasySettingsValueTableTests;
+
+	FEasySettingsValueTable Table;
+
+	// The newest generation of every setting, so readers mostly ask for handles that are live and sometimes for ones that were just retired.
+	std::atomic<int32> LatestGenerations[NumSettings];
+	for (std::atomic<int32>& Generation : LatestGenerations)
+	{
+		Generation.store(0, std::memory_order_relaxed);
+	}
+
+	std::atomic<bool> bStop(false);
+	std::atomic<int64> Reads(0);
+	std::atomic<int64> Mismatches(0);
+
+	TArray<TFuture<void>> Readers;
+	for (int32 ReaderIndex = 0; ReaderIndex < NumReaders; ++ReaderIndex)
+	{
+		Readers.Add(Async(EAsyncExecution::Thread, [&Table, &LatestGenerations, &bStop, &Reads, &Mismatches, ReaderIndex]()
+		{
+			int64 LocalReads = 0;
+			int64 LocalMismatches = 0;
+			int32 Index = ReaderIndex;
+			while (!bStop.load(std::memory_order_relaxed))
+			{
+				Index = (Index + 31) % NumSettings;
+				const int32 Latest = LatestGenerations[Index].load(std::memory_order_relaxed);
+
+				// Any value handed back has to have been published under exactly the generation that was asked for.
+				for (int32 Generation = FMath::Max(Latest - 1, 0); Generation <= Latest + 1; ++Generation)
+				{
+					const FSettingHandle Handle(Index, Generation);
+					if (IsFloatSetting(Index))
+					{
+						float Value;
+						if (Table.TryReadFloat(Handle, Value))
+						{
+							++LocalReads;
+							LocalMismatches += Value != float(Generation);
+						}
+					}
+					else
+					{
+						int32 Value;
+						if (Table.TryReadInt(Handle, Value))
+						{
+							++LocalReads;
+							LocalMismatches += (Value >> 16) != Generation;
+						}
+					}
+				}
+			}
+
+			Reads += LocalReads;
+			Mismatches += LocalMismatches;
+		}));
+	}
+
+	// Writes stay on the game thread, the same as the registry's.
+	TArray<int32> Generations;
+	Generations.SetNumZeroed(NumSettings);
+	for (int32 Pass = 0; Pass < NumWriterPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumSettings; ++Index)
+		{
+			if (Pass > 0 && (Pass + Index) % RetireInterval == 0)
+			{
+				Table.Retire(FSettingHandle(Index, Generations[Index]));
+				++Generations[Index];
+			}
+
+			const FSettingHandle Handle(Index, Generations[Index]);
+			if (IsFloatSetting(Index))
+			{
+				Table.PublishFloat(Handle, float(Generations[Index]));
+			}
+			else
+			{
+				Table.PublishInt(Handle, EncodeInt(Generations[Index], Pass));
+			}
+			LatestGenerations[Index].store(Generations[Index], std::memory_order_relaxed);
+		}
+	}
+
+	bStop = true;
+	for (TFuture<void>& Reader : Readers)
+	{
+		Reader.Wait();
+	}
+
+	TestEqual(TEXT("Values read under the wrong generation"), Mismatches.load(), int64(0));
+	TestTrue(TEXT("Readers saw published values"), Reads.load() > 0);
+
+	// Once the writer is done, every live handle resolves and every retired one fails.
+	for (int32 Index = 0; Index < NumSettings; ++Index)
+	{
+		float FloatValue;
+		int32 IntValue;
+		const FSettingHandle Live(Index, Generations[Index]);
+		const bool bLiveReads = IsFloatSetting(Index) ? Table.TryReadFloat(Live, FloatValue) : Table.TryReadInt(Live, IntValue);
+		TestTrue(FString::Printf(TEXT("Setting %d resolves under its latest generation"), Index), bLiveReads);
+
+		if (Generations[Index] > 0)
+		{
+			const FSettingHandle Stale(Index, Generations[Index] - 1);
+			TestFalse(FString::Printf(TEXT("Setting %d fails under a retired generation"), Index), Table.TryReadInt(Stale, IntValue));
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -4,6 +4,8 @@
 
 #include "Modules/ModuleManager.h"
 
+EASYSETTINGS_API DECLARE_LOG_CATEGORY_EXTERN(LogEasySettings, Log, All);
+
 class FEasySettingsModule : public IModuleInterface
 {
 public:
@@ -11,4 +13,10 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	/** Flushes and releases the registry. Runs on pre exit, while GConfig is still around, or when the module is unloaded. */
+	void ShutdownRegistry();
+
+	FDelegateHandle PreExitHandle;
 };
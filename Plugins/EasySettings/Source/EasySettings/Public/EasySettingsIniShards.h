@@ -0,0 +1,32 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+
+/**
+ * Settings stored under EIniFile::Sharded live in small ini files of their own, one per FSettingBase::Shard, next to the other saved ini files.
+ * GConfig rewrites a whole file on every flush, so a slider change only rewrites its shard rather than all of GameUserSettings.ini.
+ *
+ * Shards are regular GConfig files, loaded the same way as the engine's own ini files. A DefaultEasySettings_<Shard>.ini in the
+ * project's Config folder is picked up as the shard's defaults, but isn't required.
+ */
+struct EASYSETTINGS_API FEasySettingsIniShards
+{
+	/** Returns the GConfig file name of a shard, loading it into GConfig the first time it is asked for. Game thread only, same as GConfig. */
+	static FString GetIniFileName(FName Shard);
+
+	/** Returns true once a shard is in GConfig, so GetIniFileName won't touch the disk. Game thread only. */
+	static bool IsLoaded(FName Shard);
+
+	/**
+	 * Same as GetIniFileName, but reads and parses the shard's ini files on a worker thread. Only handing the parsed file to GConfig happens on the game thread.
+	 * Loading the same shard again while it is in flight waits for the same load. Game thread only.
+	 * @return	Future set on the game thread with the shard's GConfig file name, once the shard is in GConfig.
+	 */
+	static TFuture<FString> LoadAsync(FName Shard);
+
+	/** Returns the base name a shard is loaded with, e.g. EasySettings_Audio for the Audio shard, or EasySettings if Shard is None. */
+	static FString GetBaseIniName(FName Shard);
+};
@@ -0,0 +1,62 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FConfigSection;
+
+/**
+ * Notices when a saved ini file is edited by something other than GConfig, such as a launcher or a text editor, while the game is running.
+ *
+ * Polls are started from the game thread but all file access happens on a worker: each poll checks the timestamps of the watched files,
+ * and only files that changed are read and parsed. Only the sections the caller asked for are handed back, so applying the result
+ * costs the same as reading those sections from GConfig.
+ */
+class EASYSETTINGS_API FEasySettingsIniWatcher
+{
+public:
+	FEasySettingsIniWatcher();
+	~FEasySettingsIniWatcher();
+
+	FEasySettingsIniWatcher(const FEasySettingsIniWatcher&) = delete;
+	FEasySettingsIniWatcher& operator=(const FEasySettingsIniWatcher&) = delete;
+
+	/** Starts watching an ini file, taking its current timestamp as the baseline. Edits made before this call are not reported. Does nothing if the file is already watched. */
+	void Watch(const FString& IniFileName);
+
+	/** Stops watching every file, waiting for a poll that is still running. */
+	void Reset();
+
+	/** Returns true if any file is being watched. */
+	bool IsWatching() const { return WatchedFiles.Num() > 0; }
+
+	/** Takes the current timestamp as the new baseline, so a write GConfig just made isn't mistaken for an outside edit. */
+	void NotifyWritten(const FString& IniFileName);
+
+	/** Returns true while a poll is running on a worker. */
+	bool IsPolling() const { return InFlightPoll.IsValid(); }
+
+	/**
+	 * Starts a poll on a worker thread. Does nothing if one is already running.
+	 * @param SectionsByIniFile		For each watched file worth checking, the sections to hand back when it changes. Other watched files are skipped.
+	 */
+	void BeginPoll(TMap<FString, TSet<FString>>&& SectionsByIniFile);
+
+	/**
+	 * Collects the result of a finished poll.
+	 * @param OnIniFileChanged	Called once per changed file with the requested sections found in it. Sections that are no longer in the file are left out.
+	 * @return					False if no poll has finished since the last call.
+	 */
+	bool TryFinishPoll(TFunctionRef<void(const FString& IniFileName, const TMap<FString, FConfigSection>& Sections)> OnIniFileChanged);
+
+private:
+	/** Everything a poll reads and produces. Shared with the worker, so it outlives the watcher if the worker is still running. */
+	struct FPoll;
+
+	/** Last timestamp seen for each watched ini file, keyed by GConfig file name. */
+	TMap<FString, FDateTime> WatchedFiles;
+
+	/** @see IsPolling */
+	TSharedPtr<FPoll, ESPMode::ThreadSafe> InFlightPoll;
+};
@@ -0,0 +1,120 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "EasySettingsTraits.h"
+
+class IFileHandle;
+
+/**
+ * Append-only log of setting changes, written next to the ini files. Persisting a change appends one fixed size record instead of
+ * rewriting a whole ini file, so a write costs the same however many settings share the file.
+ *
+ * Records are keyed by the hash of the setting's TMapKey, so they keep the EIniFile, Section and Key addressing of the ini files.
+ * On load the latest record of each setting wins over what the ini holds. The registry occasionally folds the records back into GConfig
+ * and flushes the ini files, after which the records are dropped from the journal and the ini files are all that is needed to read the settings.
+ */
+class EASYSETTINGS_API FEasySettingsJournal
+{
+public:
+	/** A single journaled value. Fixed size, so a torn write at the end of the file is easy to spot. */
+	struct FRecord
+	{
+		/** @see FEasySettingsSnapshot::HashKey */
+		uint64 KeyHash = 0;
+
+		/** Raw bits of the value, the same as in the snapshot. */
+		uint32 ValueBits = 0;
+
+		/** ESettingType of the setting, so a record is ignored once the setting changed type. */
+		uint8 Type = 0;
+
+		uint8 Padding[3] = {};
+	};
+
+	FEasySettingsJournal();
+	~FEasySettingsJournal();
+
+	FEasySettingsJournal(const FEasySettingsJournal&) = delete;
+	FEasySettingsJournal& operator=(const FEasySettingsJournal&) = delete;
+
+	/** Reads every record from the journal file, creating it if it is missing or malformed, then keeps it open for appending. */
+	bool Open(const FString& InFilename);
+
+	/** Waits for a running compaction and closes the file. */
+	void Close();
+
+	/** Returns true between Open and Close. */
+	bool IsOpen() const { return !Filename.IsEmpty(); }
+
+	/**
+	 * Finds the latest journaled value of a setting. Returns false if there is none, or it was written for another setting type.
+	 * Settings are passed by their FEasySettingsSnapshot::HashKey, which the registry keeps per slot instead of the TMapKey itself.
+	 */
+	bool TryFind(uint64 KeyHash, ESettingType Type, uint32& OutValueBits) const;
+
+	/** Returns true if the setting has a journaled value that hasn't been folded back into its ini file. */
+	bool Contains(uint64 KeyHash) const;
+
+	/** Appends a record to the end of the file. Records appended while a compaction is running are held in memory and written once it finishes. */
+	void Append(uint64 KeyHash, ESettingType Type, uint32 ValueBits);
+
+	/** Number of records appended since the journal was opened or last compacted, including ones overwritten by a later record of the same setting. */
+	int32 GetNumAppended() const { return NumAppended; }
+
+	/**
+	 * Drops the records of settings the caller has folded back into the ini files and flushed, then rewrites the file on a worker thread with the rest.
+	 * The old file is only replaced once the new one is complete, so a crash during compaction loses nothing.
+	 * @param FoldedKeys	Key hashes of the folded settings.
+	 */
+	void BeginCompaction(const TArray<uint64>& FoldedKeys);
+
+	/** Returns true while a compaction is rewriting the file. */
+	bool IsCompacting() const { return CompactionTask.IsValid(); }
+
+	/**
+	 * Finishes a compaction once its worker is done, writing out the records appended in the meantime.
+	 * @param bWait	Blocks until the worker is done instead of returning false while it is still running.
+	 * @return		True if no compaction is running anymore.
+	 */
+	bool TryFinishCompaction(bool bWait = false);
+
+	/** Returns the journal file name, next to the saved ini files. */
+	static FString GetDefaultFilename();
+
+private:
+	struct FHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+	};
+
+	static constexpr uint32 JournalMagic = 0x4A534553; // "SESJ"
+	static constexpr uint32 JournalVersion = 1;
+
+	/** Opens Filename for appending, writing a header first if the file is empty. */
+	bool OpenForAppend();
+
+	/** Writes records to the end of the open file and flushes them to the OS. */
+	void WriteRecords(TArrayView<const FRecord> Records);
+
+	FString Filename;
+
+	TUniquePtr<IFileHandle> FileHandle;
+
+	/** Latest record of every journaled setting, keyed by KeyHash. */
+	TMap<uint64, FRecord> Latest;
+
+	/** @see GetNumAppended */
+	int32 NumAppended = 0;
+
+	/** Records appended while a compaction is running. */
+	TArray<FRecord> HeldRecords;
+
+	/** @see IsCompacting */
+	TFuture<bool> CompactionTask;
+};
+
+static_assert(sizeof(FEasySettingsJournal::FRecord) == 16, "Journal records are read and written as raw bytes.");
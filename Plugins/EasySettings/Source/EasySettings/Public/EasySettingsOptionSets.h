@@ -0,0 +1,69 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Option names of an enum setting, or the two toggles of an opposing toggles setting.
+ * Owned by an FEasySettingsOptionSetTable and shared by every setting authored with the same names, so it is never modified once interned.
+ */
+struct FEasySettingsOptionSet
+{
+	/** The option names as authored. */
+	TArray<FString> Options;
+
+	/** Lowercase option names as written to the ini, folded once when interned rather than on every write. */
+	TArray<FString> Tokens;
+
+	/** Option name to option index. FString keys hash and compare without case, so lookups don't need a lowercase copy of the ini value. */
+	TMap<FString, int32> Lookup;
+
+	int32 Num() const { return Options.Num(); }
+
+	/** Returns the index of the option matching an ini value, ignoring case, or INDEX_NONE if nothing matched. */
+	int32 Find(const FString& Value) const
+	{
+		const int32* OptionIndex = Lookup.Find(Value);
+		return OptionIndex ? *OptionIndex : INDEX_NONE;
+	}
+
+	/** Heap memory used by the names and the lookup table. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Heap memory used by the characters of the names and tokens alone. */
+	SIZE_T GetNamesAllocatedSize() const;
+};
+
+/**
+ * Interns option names, so settings authored with the same names point at one FEasySettingsOptionSet instead of each keeping a copy.
+ * Most games only use a handful of option lists ("Low, Medium, High, Epic", "On, Off") across all their settings.
+ *
+ * Names are matched with case, as the authored names are what GetEnumSetting and GetOpposingTogglesSetting hand back.
+ * Sets are only freed by Reset, releasing a setting leaves its set in the table for the next setting that uses the same names.
+ */
+class EASYSETTINGS_API FEasySettingsOptionSetTable
+{
+public:
+	/** Returns the set holding these names, adding it if no interned set matches. The reference stays valid until Reset. */
+	const FEasySettingsOptionSet& Intern(TArrayView<const FString> Options);
+
+	/** Number of distinct sets. */
+	int32 Num() const { return Sets.Num(); }
+
+	/** Heap memory used by the table and every set in it. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Frees every set. Only call once nothing points at them anymore. */
+	void Reset();
+
+private:
+	/** Case sensitive hash of a list of names. */
+	static uint32 HashOptions(TArrayView<const FString> Options);
+
+	/** Heap allocated, so the references handed out survive Sets growing. */
+	TArray<TUniquePtr<FEasySettingsOptionSet>> Sets;
+
+	/** Indices into Sets by HashOptions of their names. */
+	TMultiMap<uint32, int32> SetsByHash;
+};
@@ -0,0 +1,41 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "SettingTypes/SettingBase.h"
+#include "EasySettingsPreset.generated.h"
+
+/** A single value set by a preset. */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FEasySettingsPresetValue
+{
+	GENERATED_BODY()
+
+	/** The setting to change. It has to be set up before the preset is applied, settings that aren't registered are skipped. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Easy Settings")
+	FSettingBase SettingID;
+
+	/**
+	 * The new value, written the same way as in the ini file, e.g. "0.5" for a float, the toggle or option name for opposing toggles and enums,
+	 * or "(X=1.0,Y=2.0)" for a vector.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Easy Settings")
+	FString Value;
+};
+
+/**
+ * A named group of setting values, such as a Low, Medium, High or Ultra scalability preset.
+ * Applied through UEasySettingsRegistry::ApplyPreset, which only writes the values that differ from the current ones, as a single transaction.
+ */
+UCLASS(BlueprintType, DisplayName = "EasySettingsPreset")
+class EASYSETTINGS_API UEasySettingsPreset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Values to apply. If the same setting is listed twice, the last value wins. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FEasySettingsPresetValue> Values;
+};
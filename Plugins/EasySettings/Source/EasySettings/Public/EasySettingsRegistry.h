@@ -0,0 +1,1045 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "EasySettingsIniWatcher.h"
+#include "EasySettingsJournal.h"
+#include "EasySettingsSnapshot.h"
+#include "EasySettingsStorage.h"
+#include "EasySettingsSubsystem.h"
+#include "EasySettingsTraits.h"
+#include "EasySettingsValueTable.h"
+#include "SettingTypes/EnumSetting.h"
+#include "SettingTypes/FloatSetting.h"
+#include "SettingTypes/OpposingTogglesSetting.h"
+#include "SettingTypes/SettingHandle.h"
+#include "UObject/Object.h"
+#include "EasySettingsRegistry.generated.h"
+
+class FBoolProperty;
+class FConfigSection;
+class UEasySettingsPreset;
+class UEasySettingsSchema;
+struct FEasySettingsBakedSetting;
+
+/** One view per type in EASYSETTINGS_FOR_EACH_GENERIC_SETTING, in TSettingTraits::StorageIndex order. @see UEasySettingsRegistry::RegisterSettings */
+using FGenericSettingViews = TTuple<
+	TArrayView<FIntSetting>,
+	TArrayView<FBoolSetting>,
+	TArrayView<FVector2DSetting>,
+	TArrayView<FLinearColorSetting>,
+	TArrayView<FKeySetting>>;
+
+/**
+ * Read-only copy of the numbers backing a registered float setting. Cheap to return as the strings stay in the registry.
+ * ID points into the registry and is only valid until the next setting is registered or released.
+ */
+struct FFloatSettingView
+{
+	float Current = 0.f;
+	float Min = 0.f;
+	float Max = 0.f;
+	float Default = 0.f;
+	const FSettingBase* ID = nullptr;
+};
+
+/**
+ * Owns every registered setting and the delegates related to our various setting types.
+ * A single instance is created by the EasySettings module on startup, so settings can be set up and read before any GameInstance exists,
+ * e.g. by other modules during boot. Native code should go through Get, which is a single pointer load rather than a world and subsystem lookup.
+ * Blueprints reach it through the statics or UEasySettingsSubsystem, which forwards to this instance.
+ * Persistence can be configured under [/Script/EasySettings.EasySettingsRegistry] in DefaultGame.ini.
+ */
+UCLASS(Config = Game)
+class EASYSETTINGS_API UEasySettingsRegistry : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the registry owned by the EasySettings module. Only valid between the module's startup and engine shutdown, @see TryGet. */
+	static UEasySettingsRegistry& Get()
+	{
+		check(Instance);
+		return *Instance;
+	}
+
+	/** Returns the registry owned by the EasySettings module, or nullptr before the module started up or once the engine is shutting down. */
+	static UEasySettingsRegistry* TryGet() { return Instance; }
+
+	/**
+	 * Same as TryGet, but logs a warning naming the caller when there is no registry.
+	 * For Blueprint facing code, whose callers can still run during engine shutdown. @see WithRegistry
+	 */
+	static UEasySettingsRegistry* TryGetForCaller(const TCHAR* FunctionName);
+
+	/**
+	 * Calls Function with the registry and returns its result, or returns Fallback if there is no registry, @see TryGetForCaller.
+	 * Every function of the statics and the subsystem forwards to the registry through this.
+	 */
+	template <typename FunctionType>
+	static std::invoke_result_t<FunctionType, UEasySettingsRegistry&> WithRegistry(const TCHAR* FunctionName, const std::invoke_result_t<FunctionType, UEasySettingsRegistry&>& Fallback, FunctionType&& Function)
+	{
+		if (UEasySettingsRegistry* Registry = TryGetForCaller(FunctionName))
+		{
+			return Function(*Registry);
+		}
+		return Fallback;
+	}
+
+	/** WithRegistry for functions without a result. */
+	template <typename FunctionType>
+	static void WithRegistry(const TCHAR* FunctionName, FunctionType&& Function)
+	{
+		if (UEasySettingsRegistry* Registry = TryGetForCaller(FunctionName))
+		{
+			Function(*Registry);
+		}
+	}
+
+	/** Called by the EasySettings module once the registry has been created. Restores the snapshot and starts the tickers. */
+	void Initialize();
+
+	/** Called by the EasySettings module before GConfig is torn down. Flushes pending writes and notifications, then writes the snapshot. */
+	void Deinitialize();
+
+	using FFloatSettingChangedSignature = UEasySettingsSubsystem::FFloatSettingChangedSignature;
+	using FOpposingTogglesSettingChangedSignature = UEasySettingsSubsystem::FOpposingTogglesSettingChangedSignature;
+	using FEnumSettingChangedSignature = UEasySettingsSubsystem::FEnumSettingChangedSignature;
+	using FSettingChangedSignature = UEasySettingsSubsystem::FSettingChangedSignature;
+	using FSettingsCommittedSignature = UEasySettingsSubsystem::FSettingsCommittedSignature;
+	using FSettingChangedDynamicSignature = UEasySettingsSubsystem::FSettingChangedDynamicSignature;
+	using FOnSettingChanged = UEasySettingsSubsystem::FOnSettingChanged;
+	using FDerivedSettingDynamicFunction = UEasySettingsSubsystem::FDerivedSettingDynamicFunction;
+
+	/**
+	 * Computes a derived setting from the current values of its inputs, given in the order they were registered with.
+	 * Every input is passed as a float: floats and ints as they are, opposing toggles and bools as 1 or 0, enums as the index of the active option.
+	 * Must not register, release or update settings, it is called while the registry resolves a read.
+	 */
+	using FDerivedSettingFunction = FDerivedSettingStorage::FFunction;
+
+	/** Signals listeners whenever a float setting is updated. */
+	FFloatSettingChangedSignature FloatSettingChangedDelegate;
+
+	/** Signals listeners whenever an opposing toggles setting is updated. */
+	FOpposingTogglesSettingChangedSignature OpposingTogglesSettingChangedDelegate;
+
+	/** Signals listeners whenever an enum setting is updated. */
+	FEnumSettingChangedSignature EnumSettingChangedDelegate;
+
+	/**
+	 * Signals listeners whenever a setting going through the generic SetupSetting path is updated, e.g. an int, bool, vector, color or key setting,
+	 * and whenever a derived setting's value changes. The new value can be read through the handle, so one delegate covers every type.
+	 */
+	FSettingChangedSignature SettingChangedDelegate;
+
+	/**
+	 * Signals listeners once per committed transaction with every setting that changed.
+	 * Settings changed through a transaction do not trigger the per type delegates such as FloatSettingChangedDelegate.
+	 */
+	FSettingsCommittedSignature SettingsCommittedDelegate;
+
+	/**
+	 * Resolves the setting's Current value from the ini file, writing the Default out if it is missing or invalid, then copies the setting into the registry's storage.
+	 * Setting.Current is updated with the resolved value, but later updates are only made to the registry's copy.
+	 * @param Setting		The setting we want to setup.
+	 * @param bOutSuccess	True if the setting was set up within Min and Max values. False if the Default value could not be used.
+	 * @return				Handle to the registered setting. If a setting with the same TMapKey was already setup, it is left untouched and its handle is returned.
+	 */
+	FSettingHandle SetupFloatSetting(FFloatSetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Resolves the active toggle from the ini file, writing the default out if it is missing or invalid, then copies the setting into the registry's storage.
+	 * Setting.bFirstIsActive is updated with the resolved value, but later updates are only made to the registry's copy.
+	 * @return	Handle to the registered setting. If a setting with the same TMapKey was already setup, it is left untouched and its handle is returned.
+	 */
+	FSettingHandle SetupOpposingTogglesSetting(FOpposingTogglesSetting& Setting);
+
+	/**
+	 * Resolves the active option from the ini file, writing the Default out if it is missing or invalid, then copies the setting into the registry's storage.
+	 * Setting.Current is updated with the resolved value, but later updates are only made to the registry's copy.
+	 * @param Setting		The setting we want to setup.
+	 * @param bOutSuccess	False if the setting has no Options, in which case nothing is registered, or if the Default was not one of the Options.
+	 * @return				Handle to the registered setting. If a setting with the same TMapKey was already setup, it is left untouched and its handle is returned.
+	 */
+	FSettingHandle SetupEnumSetting(FEnumSetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Setup for any setting type listed in EASYSETTINGS_FOR_EACH_GENERIC_SETTING, such as FIntSetting or FKeySetting.
+	 * Parsing and validation come from the type's TSettingTraits, so there is no per type code in the registry.
+	 * @param Setting		The setting we want to setup. Current is updated with the resolved value.
+	 * @param bOutSuccess	False if the Default did not pass the setting's validator.
+	 * @return				Handle to the registered setting. If a setting with the same TMapKey was already setup, it is left untouched and its handle is returned.
+	 */
+	template <typename SettingType>
+	FSettingHandle SetupSetting(SettingType& Setting, bool& bOutSuccess);
+
+	/**
+	 * SetupFloatSetting for level loads, without file access on the game thread. If the setting's ini file is already in GConfig it is set up straight away,
+	 * as that is only a lookup in memory. Otherwise the ini file is read and parsed on a worker thread, and the setting is set up once it is back on the game thread.
+	 * Missing defaults are written to GConfig but always left to the write-behind flush, even with bWriteBehindPersistence disabled.
+	 * Once set up, the setting's change delegates are broadcast with the resolved value.
+	 * @return	Set on the game thread with the handle SetupFloatSetting would have returned, or an invalid handle if the registry was shut down first.
+	 */
+	TFuture<FSettingHandle> SetupFloatSettingAsync(const FFloatSetting& Setting);
+
+	/** @see SetupFloatSettingAsync */
+	TFuture<FSettingHandle> SetupOpposingTogglesSettingAsync(const FOpposingTogglesSetting& Setting);
+
+	/** @see SetupFloatSettingAsync */
+	TFuture<FSettingHandle> SetupEnumSettingAsync(const FEnumSetting& Setting);
+
+	/** Returns true while an asynchronous Setup of the setting is waiting for its ini file. */
+	bool IsSettingResolving(const FSettingBase& SettingID) const { return ResolvingSettings.Contains(SettingID.GetTMapKey()); }
+
+	/**
+	 * Registers every setting declared in a schema asset. @see the native overload for how the ini files are read and written.
+	 * A cooked schema was validated and had its keys and hashes worked out by the cook, so only the values are resolved here.
+	 * @param Schema						The settings to register.
+	 * @param OutFloatHandles				Handle for each of Schema's FloatSettings, in the same order.
+	 * @param OutOpposingTogglesHandles		Handle for each of Schema's OpposingTogglesSettings, in the same order.
+	 * @param OutEnumHandles				Handle for each of Schema's EnumSettings, in the same order.
+	 * @param OutGenericHandles				Handle for each of Schema's settings of the types in EASYSETTINGS_FOR_EACH_GENERIC_SETTING, e.g. IntSettings.
+	 */
+	void RegisterSettings(const UEasySettingsSchema* Schema, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+		FEasySettingsGenericHandles& OutGenericHandles);
+
+	/**
+	 * Same as calling the Setup functions on every setting, but reads each ini section once, writes any missing defaults in one batch
+	 * and flushes each ini file at most once, so the cost grows with the number of ini files rather than the number of settings.
+	 * Each setting's Current or bFirstIsActive is updated with the resolved value.
+	 * @param OutFloatHandles				Handle for each of FloatSettings, in the same order.
+	 * @param OutOpposingTogglesHandles		Handle for each of OpposingTogglesSettings, in the same order.
+	 * @param OutEnumHandles				Handle for each of EnumSettings, in the same order. Invalid for settings without any Options.
+	 * @param OutGenericHandles				Handle for each of GenericSettings' settings, in the same order as the view it is in.
+	 */
+	void RegisterSettings(TArrayView<FFloatSetting> FloatSettings, TArrayView<FOpposingTogglesSetting> OpposingTogglesSettings, TArrayView<FEnumSetting> EnumSettings, const FGenericSettingViews& GenericSettings,
+		TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles, FEasySettingsGenericHandles& OutGenericHandles);
+
+	/** RegisterSettings for the float, opposing toggles and enum settings only. */
+	void RegisterSettings(TArrayView<FFloatSetting> FloatSettings, TArrayView<FOpposingTogglesSetting> OpposingTogglesSettings, TArrayView<FEnumSetting> EnumSettings,
+		TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles);
+
+	/**
+	 * Registers a setting computed from other registered settings, e.g. a look rate from a base turn rate, a sensitivity and an invert toggle.
+	 * Inputs can be derived settings themselves. They have to be registered first, so the dependencies always form a graph without cycles.
+	 * A change to a setting only marks the derived settings downstream of it dirty. Those are recomputed when they are read, or at the end of the frame,
+	 * where their listeners and SettingChangedDelegate are notified if the result actually changed. Derived settings are never written to an ini file.
+	 * A derived setting keeps its last value once one of its inputs is released.
+	 * @param Name		Names the setting in logs and FindHandle, with an EIniFile::Game ini file and a section of EasySettings.Derived.
+	 * @param Inputs	Float, opposing toggles, enum, int, bool or derived settings. Vectors, colors and keys don't convert to a float.
+	 * @return			Handle to the registered setting, or an invalid handle if an input is stale or of an unsupported type.
+	 *					If a derived setting with the same Name was already registered, it is left untouched and its handle is returned.
+	 */
+	FSettingHandle RegisterDerivedSetting(FName Name, TArrayView<const FSettingHandle> Inputs, FDerivedSettingFunction&& Function);
+
+	/** Blueprint counterpart of RegisterDerivedSetting, computing the setting through a bound event. */
+	FSettingHandle RegisterDerivedSetting(FName Name, TArrayView<const FSettingHandle> Inputs, FDerivedSettingDynamicFunction Function);
+
+	/** Returns the value of a derived setting, recomputing it first if one of its inputs changed. Returns false if the handle is stale or refers to another setting type. */
+	bool TryGetDerivedValue(FSettingHandle Handle, float& OutValue);
+
+	/**
+	 * Recomputes every dirty derived setting and notifies the listeners of those whose value changed.
+	 * Runs at the end of every frame once a derived setting is registered. Call it directly where frames don't tick, e.g. in a commandlet.
+	 */
+	void UpdateDerivedSettings();
+
+	/** Removes a setting from the setting table. Any handles to it go stale. Returns false if the handle was already stale. */
+	bool ReleaseSetting(FSettingHandle Handle);
+
+	/** Returns the handle registered under TMapKey, or an invalid handle if nothing was registered. */
+	FSettingHandle FindHandle(const FString& TMapKey) const;
+
+	/** Returns the type of the registered setting, or None if the handle is stale. */
+	ESettingType GetSettingType(FSettingHandle Handle) const;
+
+	/** Returns the ini file, section and key of the registered setting, or nullptr if the handle is stale. Invalidated by the next registration or release. */
+	const FSettingBase* GetSettingID(FSettingHandle Handle) const;
+
+	/** Returns false if the handle is stale or refers to another setting type. */
+	bool TryGetFloatValue(FSettingHandle Handle, float& OutCurrent) const;
+
+	/** Returns false if the handle is stale or refers to another setting type. */
+	bool GetFloatSettingView(FSettingHandle Handle, FFloatSettingView& OutView) const;
+
+	/** Rebuilds a full FFloatSetting from storage. Prefer TryGetFloatValue or GetFloatSettingView, this copies every string. */
+	bool GetFloatSetting(FSettingHandle Handle, FFloatSetting& OutSetting) const;
+
+	/** Returns false if the handle is stale or refers to another setting type. */
+	bool TryGetOpposingTogglesValue(FSettingHandle Handle, bool& bOutFirstIsActive) const;
+
+	/** Rebuilds a full FOpposingTogglesSetting from storage. Prefer TryGetOpposingTogglesValue, this copies every string. */
+	bool GetOpposingTogglesSetting(FSettingHandle Handle, FOpposingTogglesSetting& OutSetting) const;
+
+	/** Returns false if the handle is stale or refers to another setting type. */
+	bool TryGetEnumValue(FSettingHandle Handle, int32& OutCurrent) const;
+
+	/** Rebuilds a full FEnumSetting from storage. Prefer TryGetEnumValue, this copies every option name. */
+	bool GetEnumSetting(FSettingHandle Handle, FEnumSetting& OutSetting) const;
+
+	/** Returns false if the handle is stale or refers to another setting type. */
+	template <typename SettingType>
+	bool TryGetValue(FSettingHandle Handle, typename TSettingTraits<SettingType>::ValueType& OutCurrent) const;
+
+	/** Rebuilds a full setting from storage. */
+	template <typename SettingType>
+	bool GetSetting(FSettingHandle Handle, SettingType& OutSetting) const;
+
+	/**
+	 * Returns the TMapKey a handle was registered with. Intended for logging, returns an empty string for stale handles.
+	 * The key isn't stored per setting, it is rebuilt from the setting's ini file, section and key on every call.
+	 */
+	FString GetTMapKey(FSettingHandle Handle) const;
+
+	/**
+	 * Returns the thread safe mirror of every registered setting's current value.
+	 * Worker and render threads should keep the returned reference and read through it, rather than touching the registry.
+	 */
+	TSharedRef<const FEasySettingsValueTable, ESPMode::ThreadSafe> GetValueTable() const { return ValueTable; }
+
+	/**
+	 * Binds a native listener that is only called when the given setting changes, rather than on every change like the global delegates.
+	 * @return	An invalid FDelegateHandle if the setting handle is stale.
+	 */
+	FDelegateHandle SubscribeToSetting(FSettingHandle Handle, FOnSettingChanged::FDelegate&& Listener);
+
+	/** Removes a native listener that was bound through SubscribeToSetting. */
+	void UnsubscribeFromSetting(FSettingHandle Handle, FDelegateHandle ListenerHandle);
+
+	/**
+	 * Binds an event that is only called when the given setting changes, rather than on every change like the global delegates.
+	 * Binding the same event twice has no effect.
+	 * @return	False if the setting handle is stale.
+	 */
+	bool BindToSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event);
+
+	/** Removes an event that was bound through BindToSettingChanged. */
+	void UnbindFromSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event);
+
+	/**
+	 * Opts a setting out of bCoalesceChangeNotifications, for listeners that need every intermediate value rather than the last one of the frame.
+	 * @return	False if the setting handle is stale.
+	 */
+	bool SetNotifyOnEveryChange(FSettingHandle Handle, bool bEveryChange);
+
+	/** Immediately delivers every change notification held back by bCoalesceChangeNotifications, instead of waiting for the end of the frame. */
+	void FlushPendingNotifications();
+
+	/**
+	 * Keeps a member of Owner equal to the setting's current value, so it can be read directly instead of going through the registry or a delegate.
+	 * The member is written as soon as it is bound and on every change after that, including changes held back by bCoalesceChangeNotifications.
+	 * The binding is dropped once Owner is destroyed, or explicitly through UnbindObjectFromSetting.
+	 * Supported member types are float, bool, int32, FVector2D, FLinearColor and FKey, and must match the setting's value type.
+	 * @param Member	Must point inside Owner.
+	 * @return	False if the handle is stale, the types don't match or Member is not part of Owner.
+	 */
+	template <typename ValueType>
+	bool BindMemberToSetting(FSettingHandle Handle, UObject* Owner, ValueType* Member);
+
+	/**
+	 * Blueprint friendly version of BindMemberToSetting, which looks the variable up by name.
+	 * Float settings may also be bound to double variables, which is what Blueprint float variables are.
+	 * @return	False if the handle is stale, Object has no variable named PropertyName or its type doesn't match the setting.
+	 */
+	bool BindPropertyToSetting(FSettingHandle Handle, UObject* Object, FName PropertyName);
+
+	/** Removes every member or variable of Object that was bound to the setting. */
+	void UnbindObjectFromSetting(FSettingHandle Handle, UObject* Object);
+
+	/**
+	 * Validates NewCurrent, writes it to the ini file, then notifies the setting's own subscribers and FloatSettingChangedDelegate.
+	 * @return	False if the handle is stale, NewCurrent is outside the Min and Max values or nothing changed.
+	 */
+	bool UpdateFloatSetting(FSettingHandle Handle, float NewCurrent);
+
+	/**
+	 * Writes the new active toggle to the ini file, then notifies the setting's own subscribers and OpposingTogglesSettingChangedDelegate.
+	 * @return	False if the handle is stale or nothing changed.
+	 */
+	bool UpdateOpposingTogglesSetting(FSettingHandle Handle, bool bActivateFirst);
+
+	/**
+	 * Validates NewCurrent, writes the matching option to the ini file, then notifies the setting's own subscribers and EnumSettingChangedDelegate.
+	 * @return	False if the handle is stale, NewCurrent is not the index of one of the Options or nothing changed.
+	 */
+	bool UpdateEnumSetting(FSettingHandle Handle, int32 NewCurrent);
+
+	/**
+	 * Validates NewCurrent with the type's validator, writes it to the ini file, then notifies the setting's own subscribers and SettingChangedDelegate.
+	 * @return	False if the handle is stale or refers to another setting type, NewCurrent is invalid or nothing changed.
+	 */
+	template <typename SettingType>
+	bool UpdateSetting(FSettingHandle Handle, const typename TSettingTraits<SettingType>::ValueType& NewCurrent);
+
+	/**
+	 * Opens a transaction. Updates staged while it is open are only applied once CommitTransaction is called.
+	 * @return	False if a transaction is already open.
+	 */
+	bool BeginTransaction();
+
+	/**
+	 * Stages a float update in the open transaction. Staging the same setting twice keeps the latest value.
+	 * @return	False if no transaction is open or the handle does not refer to a registered float setting.
+	 */
+	bool StageFloatSetting(FSettingHandle Handle, float NewCurrent);
+
+	/**
+	 * Stages an opposing toggles update in the open transaction. Staging the same setting twice keeps the latest value.
+	 * @return	False if no transaction is open or the handle does not refer to a registered opposing toggles setting.
+	 */
+	bool StageOpposingTogglesSetting(FSettingHandle Handle, bool bActivateFirst);
+
+	/**
+	 * Stages an enum update in the open transaction. Staging the same setting twice keeps the latest value.
+	 * @return	False if no transaction is open or the handle does not refer to a registered enum setting.
+	 */
+	bool StageEnumSetting(FSettingHandle Handle, int32 NewCurrent);
+
+	/**
+	 * Stages an update to a generic setting in the open transaction. Staging the same setting twice keeps the latest value.
+	 * @return	False if no transaction is open or the handle does not refer to a registered setting of this type.
+	 */
+	template <typename SettingType>
+	bool StageSetting(FSettingHandle Handle, const typename TSettingTraits<SettingType>::ValueType& NewCurrent);
+
+	/**
+	 * Validates every staged update, then applies them with a single ini write and flush per file and one SettingsCommittedDelegate broadcast.
+	 * Listeners bound to an individual setting are still notified for each setting that changed.
+	 * If any staged update is invalid nothing is applied, and the transaction stays open so it can be corrected or rolled back.
+	 * @param OutChangedHandles		Settings whose value actually changed. Staged values that matched the current value are skipped.
+	 * @return						False if no transaction is open or validation failed.
+	 */
+	bool CommitTransaction(TArray<FSettingHandle>& OutChangedHandles);
+
+	/** Discards every staged update and closes the open transaction. */
+	void RollbackTransaction();
+
+	/** Returns true between BeginTransaction and a successful CommitTransaction or RollbackTransaction. */
+	bool IsTransactionOpen() const { return bTransactionOpen; }
+
+	/**
+	 * Applies every value of a preset that differs from the current one as a single transaction, so each touched ini file is written once
+	 * and SettingsCommittedDelegate is broadcast once. A preview is reverted first, so the diff is taken against the persisted values.
+	 * @param OutChangedHandles	Settings whose value changed.
+	 * @return					False if a transaction is open or a value could not be parsed or validated, in which case nothing is applied.
+	 */
+	bool ApplyPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles);
+
+	/**
+	 * Shows a preset's values without persisting them. Storage, the value table, bound members and per setting listeners see the new values,
+	 * but nothing is written to GConfig or disk. Previewing another preset on top still reverts to the values from before the first preview.
+	 * @param OutChangedHandles	Settings whose value changed.
+	 * @return					False if a transaction is open or a value could not be parsed or validated, in which case nothing is previewed.
+	 */
+	bool PreviewPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles);
+
+	/**
+	 * Puts back the persisted value of every setting changed by PreviewPreset. Settings that were updated or reloaded since keep that value.
+	 * @param OutChangedHandles	Settings whose value changed.
+	 */
+	void RevertPreview(TArray<FSettingHandle>& OutChangedHandles);
+
+	/** Returns true while any previewed value has not been reverted or overwritten. */
+	bool IsPreviewingPreset() const;
+
+	/**
+	 * Sets the value a settings menu shows for a float setting without applying it. ApplyAll writes every pending value at once.
+	 * Setting it back to the applied value clears the pending change. Updating the setting in any other way discards it.
+	 * @return	False if the handle is stale or refers to another setting type, or NewPending is outside the Min and Max values.
+	 */
+	bool SetPendingFloatValue(FSettingHandle Handle, float NewPending);
+
+	/** @see SetPendingFloatValue */
+	bool SetPendingOpposingTogglesValue(FSettingHandle Handle, bool bActivateFirst);
+
+	/** @see SetPendingFloatValue */
+	bool SetPendingEnumValue(FSettingHandle Handle, int32 NewPending);
+
+	/** @see SetPendingFloatValue */
+	template <typename SettingType>
+	bool SetPendingValue(FSettingHandle Handle, const typename TSettingTraits<SettingType>::ValueType& NewPending);
+
+	/** Returns the pending value, or the applied value if nothing is pending. False if the handle is stale or refers to another setting type. */
+	bool TryGetPendingFloatValue(FSettingHandle Handle, float& OutPending) const;
+
+	/** @see TryGetPendingFloatValue */
+	bool TryGetPendingOpposingTogglesValue(FSettingHandle Handle, bool& bOutFirstIsActive) const;
+
+	/** @see TryGetPendingFloatValue */
+	bool TryGetPendingEnumValue(FSettingHandle Handle, int32& OutPending) const;
+
+	/** @see TryGetPendingFloatValue */
+	template <typename SettingType>
+	bool TryGetPendingValue(FSettingHandle Handle, typename TSettingTraits<SettingType>::ValueType& OutPending) const;
+
+	/** Returns true if the setting has a pending value that differs from the applied one. */
+	bool HasPendingChange(FSettingHandle Handle) const;
+
+	/** Returns true if the setting's pending value, or its applied value if nothing is pending, is its Default. */
+	bool IsPendingValueDefault(FSettingHandle Handle) const { const FSettingSlot* Slot = ResolveSlot(Handle); return Slot && !Slot->bNonDefault; }
+
+	/** Returns true if any setting has a pending change, e.g. to enable a menu's Apply button. Kept up to date as values change, so this doesn't visit the settings. */
+	bool HasAnyPendingChanges() const;
+
+	/** Returns true if any setting's pending value is not its Default, e.g. to enable a menu's Reset button. @see HasAnyPendingChanges */
+	bool HasAnyNonDefaultSettings() const { return NonDefaultCount > 0; }
+
+	/**
+	 * Applies every pending change as a single transaction, the same as CommitTransaction.
+	 * @param OutChangedHandles	Settings whose value changed.
+	 * @return					False if a transaction is open, in which case nothing is applied.
+	 */
+	bool ApplyAll(TArray<FSettingHandle>& OutChangedHandles);
+
+	/** Discards every pending change, so menus show the applied values again. Nothing is written. */
+	void RevertAll();
+
+	/** Sets every setting's pending value to its Default. Nothing is written until ApplyAll. */
+	void ResetAllToDefault();
+
+	/**
+	 * Creates a named profile, e.g. for a local player, a platform or a benchmark, and loads the values it overrides from its own ini file.
+	 * A profile only stores the values it overrides. Every other setting falls through to the parent profile, and eventually to the setting's Default.
+	 * @param ProfileName	Name of the profile, also used for its ini file, EasySettings_Profile_<ProfileName>.ini.
+	 * @param ParentProfile	Profile this one is layered over, or None to layer it over the Defaults.
+	 * @return				False if ProfileName is None or already exists, or ParentProfile doesn't exist.
+	 */
+	bool CreateProfile(FName ProfileName, FName ParentProfile = NAME_None);
+
+	/**
+	 * Creates a profile with the same parent and overrides as SourceProfile, and writes them to the new profile's ini file.
+	 * The overrides are shared in memory until either profile is written to.
+	 * @return	False if SourceProfile doesn't exist, or NewProfile is None or already exists.
+	 */
+	bool CopyProfile(FName SourceProfile, FName NewProfile);
+
+	/**
+	 * Forgets a profile and empties its ini file.
+	 * @return	False if the profile doesn't exist, is active or another profile is layered over it.
+	 */
+	bool DeleteProfile(FName ProfileName);
+
+	/**
+	 * Makes a profile the one settings are read from and written to. Every setting is re-resolved in a single pass without writing anything,
+	 * and only the settings whose value changed are notified, with one SettingsCommittedDelegate broadcast.
+	 * While a profile is active, updates, commits and ApplyAll are persisted to the profile's ini file instead of the setting's own,
+	 * and ReloadFromConfig and outside edits only reach GConfig, they are picked up when going back to None.
+	 * A preview is reverted first, as its persisted values belong to the previous profile.
+	 * @param ProfileName		The profile to activate, or None to go back to the values in the settings' own ini files.
+	 * @param OutChangedHandles	Settings whose value changed.
+	 * @return					False if the profile doesn't exist or a transaction is open.
+	 */
+	bool SetActiveProfile(FName ProfileName, TArray<FSettingHandle>& OutChangedHandles);
+
+	/** Returns the active profile, or None if settings are read from their own ini files. */
+	FName GetActiveProfile() const { return ActiveProfile; }
+
+	/**
+	 * Re-reads every registered setting stored in the given ini file from GConfig, for when something else has changed the values behind our back.
+	 * Float values are revalidated in bulk. A missing, unparsable or invalid value of any type keeps the setting's current value. Settings whose value changed are published and their listeners notified as if they were updated.
+	 * @param IniFile			The ini file to reload.
+	 * @param OutChangedHandles	Settings whose value changed.
+	 */
+	void ReloadFromConfig(EIniFile IniFile, TArray<FSettingHandle>& OutChangedHandles);
+
+	/**
+	 * Called after a setting has been written to GConfig. Flushes the ini file straight away, or queues it for the next write-behind flush when bWriteBehindPersistence is enabled.
+	 * @param IniFileName	The file name returned by FSettingBase::GetIniFileName.
+	 */
+	void MarkIniDirty(const FString& IniFileName);
+
+	/** Immediately flushes every ini file that is waiting on a write-behind flush. */
+	void FlushDirtyIniFiles();
+
+	/** Returns how many flushes were requested, performed and coalesced since the registry was initialized. */
+	FEasySettingsPersistenceStats GetPersistenceStats() const { return PersistenceStats; }
+
+	/**
+	 * Measures the memory taken by the names of every registered setting, next to an estimate of what they would take without sharing.
+	 * Walks every setting, so it is meant for reports rather than every frame.
+	 */
+	FEasySettingsMemoryStats GetMemoryStats() const;
+
+	/**
+	 * When true, updates only mark their ini file dirty and each dirty file is flushed at most once every WriteBehindFlushInterval seconds.
+	 * Pending writes are always flushed when the registry is deinitialized.
+	 */
+	UPROPERTY(Config, Category = "Easy Settings|Persistence")
+	bool bWriteBehindPersistence = true;
+
+	/** Minimum number of seconds between two flushes of the same ini file while bWriteBehindPersistence is enabled. */
+	UPROPERTY(Config, Category = "Easy Settings|Persistence", meta = (ClampMin = "0.0", Units = "s"))
+	float WriteBehindFlushInterval = 1.f;
+
+	/**
+	 * When true, a binary snapshot of every registered setting is written next to the ini files on shutdown and memory mapped on the next boot,
+	 * so the Setup functions can skip GConfig lookups. Entries are only used while the ini file they came from is unchanged.
+	 */
+	UPROPERTY(Config, Category = "Easy Settings|Persistence")
+	bool bUseSettingsSnapshot = false;
+
+	/**
+	 * When true, updates and commits append a small fixed size record to a journal next to the ini files instead of rewriting the ini file.
+	 * Journaled values win over the ini files on the next boot. Values that don't fit in a record, such as vectors, colors and keys, still go through the ini files.
+	 * Once JournalCompactionThreshold records were appended, the journal is folded back into the ini files and rewritten on a worker thread.
+	 */
+	UPROPERTY(Config, Category = "Easy Settings|Persistence")
+	bool bUseSettingsJournal = false;
+
+	/** Number of records appended to the journal before it is folded back into the ini files while bUseSettingsJournal is enabled. */
+	UPROPERTY(Config, Category = "Easy Settings|Persistence", meta = (ClampMin = "1"))
+	int32 JournalCompactionThreshold = 256;
+
+	/**
+	 * When true, the saved ini files are checked for outside edits, e.g. by a launcher, every IniWatchInterval seconds.
+	 * Changed files are read and parsed on a worker thread. Only the sections holding registered settings are applied to GConfig,
+	 * and only settings whose value actually changed are revalidated, published and broadcast, the same as ReloadFromConfig.
+	 * If the game and the outside edit both changed a value before it was flushed, the outside edit wins.
+	 */
+	UPROPERTY(Config, Category = "Easy Settings|Persistence")
+	bool bWatchIniFiles = false;
+
+	/** Seconds between two checks for outside edits while bWatchIniFiles is enabled. */
+	UPROPERTY(Config, Category = "Easy Settings|Persistence", meta = (ClampMin = "0.1", Units = "s"))
+	float IniWatchInterval = 1.f;
+
+	/**
+	 * When true, change notifications from updates and reloads are held until the end of the frame and delivered once per setting,
+	 * so a slider dragged across several values in one frame only runs its listeners once, with the final value.
+	 * Values are still written and published straight away. Use SetNotifyOnEveryChange to opt a setting out.
+	 * Committed transactions are already batched and keep notifying straight away.
+	 */
+	UPROPERTY(Config, Category = "Easy Settings|Notifications")
+	bool bCoalesceChangeNotifications = false;
+
+private:
+	/** Defined with the rest of the setting table below, declared here for the functions that take one. */
+	struct FSettingBinding;
+
+	/**
+	 * @see the public overload.
+	 * @param BakedSettings		A cooked schema's settings in registration order, or empty to validate, key and sort the settings here.
+	 */
+	void RegisterSettings(TArrayView<FFloatSetting> FloatSettings, TArrayView<FOpposingTogglesSetting> OpposingTogglesSettings, TArrayView<FEnumSetting> EnumSettings, const FGenericSettingViews& GenericSettings,
+		TArrayView<const FEasySettingsBakedSetting> BakedSettings, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+		FEasySettingsGenericHandles& OutGenericHandles);
+
+	/**
+	 * Resolves Current from the snapshot or the setting's ini section and registers the setting.
+	 * @param ConfigSection		The setting's section in GConfig, or nullptr if the section doesn't exist yet.
+	 * @param bOutNeedsDefault	True if the resolved value still has to be written to the ini, because it fell back to the Default or was migrated into a shard.
+	 *							Left to the caller so the writes can be batched.
+	 * @param Baked				The setting's key and hashes from a cooked schema. Its Default is already known to be valid.
+	 */
+	FSettingHandle RegisterFloatSetting(FFloatSetting& Setting, const FConfigSection* ConfigSection, bool& bOutSuccess, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked = nullptr);
+
+	/** @see RegisterFloatSetting */
+	FSettingHandle RegisterOpposingTogglesSetting(FOpposingTogglesSetting& Setting, const FConfigSection* ConfigSection, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked = nullptr);
+
+	/** @see RegisterFloatSetting */
+	FSettingHandle RegisterEnumSetting(FEnumSetting& Setting, const FConfigSection* ConfigSection, bool& bOutSuccess, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked = nullptr);
+
+	/** @see RegisterFloatSetting */
+	template <typename SettingType>
+	FSettingHandle RegisterSetting(SettingType& Setting, const FConfigSection* ConfigSection, bool& bOutSuccess, bool& bOutNeedsDefault, const FEasySettingsBakedSetting* Baked = nullptr);
+
+	/** Registers a slot for a new setting. The caller is responsible for adding the typed storage entry and setting TypedIndex. */
+	FSettingHandle AllocateSlot(const FSettingBase& SettingID, const FString& TMapKey, uint64 KeyHash, ESettingType Type);
+
+	/** Returns the ini key of a setting, used to name its trace scopes without building the TMapKey. */
+	const FString& GetTraceName(FSettingHandle Handle) const;
+
+	/** Returns the index into the typed storage for a handle, or INDEX_NONE if the handle is stale or refers to another setting type. */
+	int32 ResolveTypedIndex(FSettingHandle Handle, ESettingType Type) const;
+
+	/**
+	 * Finds the setting already registered under TMapKey, which the Setup functions hand back rather than registering it twice.
+	 * Every type shares one key map, so a key taken by a setting of another type logs an error and leaves OutHandle invalid.
+	 * @return	False if nothing is registered under the key.
+	 */
+	bool FindRegisteredSetting(const FString& TMapKey, ESettingType Type, FSettingHandle& OutHandle) const;
+
+	/**
+	 * Writes a validated float to GConfig, storage and the value table. Does not flush or broadcast.
+	 * @param bWriteToConfig	False for previews and while a profile is active, which leave the setting's own value in GConfig untouched.
+	 */
+	void WriteFloatSetting(FSettingHandle Handle, int32 TypedIndex, float NewCurrent, bool bWriteToConfig = true);
+
+	/** Writes the active toggle to GConfig, storage and the value table. Does not flush or broadcast. @see WriteFloatSetting */
+	void WriteOpposingTogglesSetting(FSettingHandle Handle, int32 TypedIndex, bool bActivateFirst, bool bWriteToConfig = true);
+
+	/** Writes a validated option index to GConfig, storage and the value table. Does not flush or broadcast. @see WriteFloatSetting */
+	void WriteEnumSetting(FSettingHandle Handle, int32 TypedIndex, int32 NewCurrent, bool bWriteToConfig = true);
+
+	/** Writes a validated value to GConfig, storage and, if it fits, the value table. Does not flush or broadcast. @see WriteFloatSetting */
+	template <typename SettingType>
+	void WriteSetting(FSettingHandle Handle, int32 TypedIndex, const typename TSettingTraits<SettingType>::ValueType& NewCurrent, bool bWriteToConfig = true);
+
+	/** What ApplyStagedSettings does with the values staged in the open transaction. */
+	enum class EApplyStaged : uint8
+	{
+		/** Writes them to GConfig, marks their ini files dirty and broadcasts SettingsCommittedDelegate. */
+		Commit,
+		/** Only changes them in memory, remembering each setting's persisted value for RevertPreview. */
+		Preview,
+		/** Only changes them in memory, used to put the persisted values back. */
+		Revert,
+	};
+
+	/**
+	 * Shared by CommitTransaction and the preset functions. Validates every staged value, applies the ones that differ from the current value,
+	 * closes the transaction and notifies the listeners of each changed setting.
+	 * @return	False if validation failed, in which case nothing is applied and the transaction stays open.
+	 */
+	bool ApplyStagedSettings(EApplyStaged Mode, TArray<FSettingHandle>& OutChangedHandles);
+
+	/** Parses a value written the same way as in the ini file with the setting's own parser, then stages it in the open transaction. */
+	bool StageSettingFromString(FSettingHandle Handle, const FString& Value);
+
+	/** Opens a transaction and stages every value of a preset. Rolls the transaction back and returns false if any value is invalid. */
+	bool StagePreset(const UEasySettingsPreset* Preset, const TCHAR* FunctionName);
+
+	/** Drops the value a setting had before it was previewed, once it was persisted, reloaded or released. */
+	void ForgetPreviewedValue(FSettingHandle Handle);
+
+	/** Shared by the asynchronous Setup functions. Calls Setup once SettingID's ini file is in GConfig, @see FinishSetupAsync. */
+	TFuture<FSettingHandle> SetupSettingAsync(const FSettingBase& SettingID, ESettingType Type, TUniqueFunction<FSettingHandle()>&& Setup);
+
+	/** Calls an asynchronous Setup without flushing, then broadcasts the new setting's change delegates. */
+	FSettingHandle FinishSetupAsync(TUniqueFunction<FSettingHandle()>& Setup);
+
+	/** Recomputes whether the setting's pending value is its Default and keeps NonDefaultCount in step. */
+	void RefreshNonDefault(FSettingHandle Handle);
+
+	/** Drops the setting's pending value once the applied value was replaced, then refreshes its default state. */
+	void DiscardPendingValue(FSettingHandle Handle);
+
+	/** Returns the storage for a generic setting type. */
+	template <typename SettingType>
+	TSettingStorage<SettingType>& GetStorage() { return GenericStorages.template Get<TSettingTraits<SettingType>::StorageIndex>(); }
+
+	template <typename SettingType>
+	const TSettingStorage<SettingType>& GetStorage() const { return GenericStorages.template Get<TSettingTraits<SettingType>::StorageIndex>(); }
+
+	/** Broadcasts the global delegate matching the setting's type. */
+	void BroadcastGlobalDelegate(FSettingHandle Handle);
+
+	/**
+	 * Shared by ReloadFromConfig and the ini watcher. Re-reads registered settings from GConfig and notifies listeners of those that changed.
+	 * @param ShouldReload	Returns true for the settings to re-read.
+	 */
+	void ReloadSettings(TFunctionRef<bool(const FSettingBase& ID)> ShouldReload, TArray<FSettingHandle>& OutChangedHandles);
+
+	/** Ticker callback that collects the last ini watcher poll and starts the next one. */
+	bool TickIniWatcher(float DeltaTime);
+
+	/**
+	 * Copies sections that were edited on disk into GConfig, then reloads the settings stored in them.
+	 * @param Sections	Sections of the ini file holding registered settings, as parsed from disk.
+	 */
+	void ApplyExternalIniChanges(const FString& IniFileName, const TMap<FString, FConfigSection>& Sections);
+
+	/** Writes every registered setting to the binary snapshot. Expects the ini files to have been flushed. */
+	void WriteSettingsSnapshot();
+
+	/** Notifies the setting's listeners and global delegate, straight away or at the end of the frame when coalescing. */
+	void DispatchSettingChanged(FSettingHandle Handle);
+
+	/** Calls the listeners bound to this setting only. */
+	void NotifySettingChanged(FSettingHandle Handle);
+
+	/** Adds a binding and writes the setting's current value through it. */
+	bool AddSettingBinding(FSettingHandle Handle, FSettingBinding&& Binding);
+
+	/** Writes the setting's current value to every member bound to it, dropping bindings whose owner was destroyed. */
+	void WriteSettingBindings(FSettingHandle Handle);
+
+	/** Called whenever a setting's value is written. Marks every derived setting downstream of it dirty, @see RegisterDerivedSetting. */
+	void MarkDerivedDirty(FSettingHandle Handle);
+
+	/** Returns the value of a derived setting, recomputing it and any dirty derived inputs first. */
+	float EvaluateDerivedSetting(int32 TypedIndex);
+
+	/** Reads a setting's current value as a derived setting's input. Returns false if the handle is stale or the value doesn't convert to a float. */
+	bool TryGetDerivedInput(FSettingHandle Handle, float& OutValue);
+
+	/** Writes a single ini file to disk and updates PersistenceStats. */
+	void FlushIniFile(const FString& IniFileName);
+
+	/** Ticker callback that flushes whatever was marked dirty since the last write-behind flush. */
+	bool TickWriteBehind(float DeltaTime);
+
+	/**
+	 * Called after a setting has been updated. Writes it to the active profile, or appends it to the journal, or marks its ini file dirty if it can't be journaled.
+	 * @param OutTouchedIniFiles	If set, ini files are added to it instead of being marked dirty, so a batch can mark each of them once.
+	 */
+	void PersistSetting(FSettingHandle Handle, TArray<FString, TInlineAllocator<4>>* OutTouchedIniFiles = nullptr);
+
+	/**
+	 * Appends the setting's current value to the journal and schedules a compaction once JournalCompactionThreshold is reached.
+	 * @return	False if the journal is disabled or the value doesn't fit in a record, in which case the ini file needs to be flushed instead.
+	 */
+	bool AppendToJournal(FSettingHandle Handle);
+
+	/** Returns the current value of the setting in the given slot, written the same way as in the ini file. */
+	FString GetValueString(int32 SlotIndex) const;
+
+	/** Writes the current value of the setting in the given slot to GConfig, without touching the storage or flushing anything. */
+	void WriteCurrentToConfig(int32 SlotIndex);
+
+	/** Writes every journaled value of a registered setting to GConfig, flushes the ini files they live in and starts rewriting the journal without them. */
+	void CompactJournal();
+
+	/** Ticker callback that compacts the journal and waits for its worker to finish. */
+	bool TickJournal(float DeltaTime);
+
+	/** Writes the setting's current value to the active profile, copying the profile's overrides first if another profile shares them. */
+	void WriteProfileValue(FSettingHandle Handle);
+
+	/** Finds the value a setting has in the active profile or one of its parents, or in GConfig if no profile is active. */
+	bool FindProfileValue(FSettingHandle Handle, FString& OutValue) const;
+
+	/**
+	 * Writes the value a setting resolves to in the active profile to storage, falling back to its Default. Nothing is persisted or notified.
+	 * @return	True if the value changed.
+	 */
+	bool ResolveProfileValue(FSettingHandle Handle);
+
+	/** Ini files that were written to but not flushed yet. */
+	TSet<FString> DirtyIniFiles;
+
+	/** Handle for the write-behind ticker, only registered while there are dirty ini files. */
+	FTSTicker::FDelegateHandle WriteBehindTickerHandle;
+
+	/** @see GetPersistenceStats */
+	FEasySettingsPersistenceStats PersistenceStats;
+
+	/** @see bUseSettingsSnapshot */
+	FEasySettingsSnapshot Snapshot;
+
+	/** @see bUseSettingsJournal */
+	FEasySettingsJournal Journal;
+
+	/** Handle for the journal compaction ticker, only registered while a compaction is due or running. */
+	FTSTicker::FDelegateHandle JournalTickerHandle;
+
+	/** Settings whose change notification is held until the end of the frame. @see bCoalesceChangeNotifications */
+	TArray<FSettingHandle> PendingNotifications;
+
+	/** Handle for the end of frame delegate, only bound while bCoalesceChangeNotifications is enabled. */
+	FDelegateHandle EndFrameHandle;
+
+	/** @see bWatchIniFiles */
+	FEasySettingsIniWatcher IniWatcher;
+
+	/** Handle for the ini watcher ticker, only registered while bWatchIniFiles is enabled. */
+	FTSTicker::FDelegateHandle IniWatchTickerHandle;
+
+	/** Derived settings computed from each setting. Only holds settings that are an input of at least one derived setting. */
+	TMap<FSettingHandle, TArray<FSettingHandle, TInlineAllocator<4>>> DerivedDependents;
+
+	/** Derived settings marked dirty since the last UpdateDerivedSettings. Read ones are no longer dirty, but still have to be checked for a change. */
+	TArray<FSettingHandle> DirtyDerivedSettings;
+
+	/** Handle for the end of frame delegate updating derived settings, only bound once one was registered. */
+	FDelegateHandle DerivedEndFrameHandle;
+
+	/** Sections holding registered settings, keyed by ini file name. Handed to every ini watcher poll. */
+	TMap<FString, TSet<FString>> WatchedSections;
+
+	/** Set whenever a setting is registered or released, so WatchedSections is rebuilt before the next poll. */
+	bool bWatchedSectionsStale = true;
+
+	/** @see BeginTransaction */
+	bool bTransactionOpen = false;
+
+	/** Float updates staged in the open transaction. */
+	TMap<FSettingHandle, float> StagedFloatSettings;
+
+	/** Opposing toggles updates staged in the open transaction. */
+	TMap<FSettingHandle, bool> StagedOpposingTogglesSettings;
+
+	/** Enum updates staged in the open transaction. */
+	TMap<FSettingHandle, int32> StagedEnumSettings;
+
+	/** Persisted values of the float settings changed by PreviewPreset, @see RevertPreview. */
+	TMap<FSettingHandle, float> PreviewedFloatSettings;
+
+	/** Persisted values of the opposing toggles settings changed by PreviewPreset. */
+	TMap<FSettingHandle, bool> PreviewedOpposingTogglesSettings;
+
+	/** Persisted values of the enum settings changed by PreviewPreset. */
+	TMap<FSettingHandle, int32> PreviewedEnumSettings;
+
+	/** Float values set by SetPendingFloatValue that differ from the applied value. */
+	TMap<FSettingHandle, float> PendingFloatSettings;
+
+	/** Opposing toggles values set by SetPendingOpposingTogglesValue that differ from the applied value. */
+	TMap<FSettingHandle, bool> PendingOpposingTogglesSettings;
+
+	/** Enum values set by SetPendingEnumValue that differ from the applied value. */
+	TMap<FSettingHandle, int32> PendingEnumSettings;
+
+	/** Number of registered settings whose FSettingSlot::bNonDefault is set. */
+	int32 NonDefaultCount = 0;
+
+	/** Number of asynchronous Setup calls waiting on each setting's ini file, keyed by TMapKey. @see IsSettingResolving */
+	TMap<FString, int32> ResolvingSettings;
+
+	/** Set while an asynchronous Setup runs, so MarkIniDirty leaves its flush to the write-behind ticker. */
+	bool bDeferIniFlushes = false;
+
+	/** Values a profile overrides, keyed by handle and written the same way as in the ini file. */
+	using FProfileOverlay = TMap<FSettingHandle, FString>;
+
+	/** A named layer of overrides, @see CreateProfile. */
+	struct FSettingsProfile
+	{
+		/** Profile this one is layered over, or None if it is layered over the Defaults. */
+		FName Parent;
+
+		/** GConfig file name the profile is persisted in. */
+		FString IniFileName;
+
+		/** Overrides of registered settings. Shared with copies of the profile until one of them is written to. */
+		TSharedRef<FProfileOverlay> Overlay = MakeShared<FProfileOverlay>();
+
+		/** Overrides of settings that aren't registered, keyed by TMapKey. Moved into Overlay once the setting is set up. */
+		TMap<FString, FString> Unresolved;
+
+		/** Returns Overlay, copying it first if another profile shares it. */
+		FProfileOverlay& GetMutableOverlay()
+		{
+			if (!Overlay.IsUnique())
+			{
+				Overlay = MakeShared<FProfileOverlay>(*Overlay);
+			}
+			return *Overlay;
+		}
+	};
+
+	/** @see CreateProfile */
+	TMap<FName, FSettingsProfile> Profiles;
+
+	/** @see SetActiveProfile */
+	FName ActiveProfile;
+
+	/** A member kept in sync with a setting, @see BindMemberToSetting. */
+	struct FSettingBinding
+	{
+		/** How the new value is stored at Address. */
+		enum class EKind : uint8
+		{
+			/** Address points at the setting's own value type. */
+			Value,
+			/** A float setting bound to a double, as Blueprint float variables are. */
+			Double,
+			/** A bool property, which may be a bitfield and has to be written through BoolProperty. */
+			BitfieldBool,
+		};
+
+		TWeakObjectPtr<UObject> Owner;
+		void* Address = nullptr;
+		const FBoolProperty* BoolProperty = nullptr;
+		EKind Kind = EKind::Value;
+	};
+
+	/** Everything that subscribed to a single setting. */
+	struct FSettingListeners
+	{
+		/** Native listeners bound through SubscribeToSetting. */
+		FOnSettingChanged Native;
+
+		/** Number of listeners bound to Native, which doesn't expose its own count. Only used for stats. */
+		int32 NumNative = 0;
+
+		/** Blueprint listeners bound through BindToSettingChanged. */
+		TArray<FSettingChangedDynamicSignature> Dynamic;
+
+		/** Members bound through BindMemberToSetting or BindPropertyToSetting. */
+		TArray<FSettingBinding> Bindings;
+	};
+
+	/** A single entry in the setting table. Only holds what is needed to resolve a handle, names live in SlotMetadata. */
+	struct FSettingSlot
+	{
+		/** Bumped whenever the slot is released. */
+		int32 Generation = 0;
+
+		ESettingType Type = ESettingType::None;
+
+		/** Index into FloatStorage, OpposingTogglesStorage, EnumStorage, one of GenericStorages or DerivedStorage, depending on Type. */
+		int32 TypedIndex = INDEX_NONE;
+
+		/** @see SetNotifyOnEveryChange */
+		bool bNotifyOnEveryChange = false;
+
+		/** True while the setting is in PendingNotifications, so it is only queued once per frame. */
+		bool bNotificationPending = false;
+
+		/** True while the pending value, or the applied value if nothing is pending, is not the Default. @see NonDefaultCount */
+		bool bNonDefault = false;
+
+		/** Only allocated once something subscribes to this setting. Shared so a broadcast survives Slots reallocating underneath it. */
+		TSharedPtr<FSettingListeners> Listeners;
+
+		/** Returns true if the slot holds a setting stored in an ini file, which excludes derived settings. */
+		bool IsPersisted() const { return Type != ESettingType::None && Type != ESettingType::Derived; }
+	};
+
+	/** Names of a registered setting, indexed the same as Slots. Only touched when talking to GConfig or logging. */
+	struct FSettingSlotMetadata
+	{
+		/** Ini file, section and key the setting is stored under. */
+		FSettingBase ID;
+
+		/** FEasySettingsSnapshot::HashKey of the TMapKey, which is what the journal and snapshot look settings up by. The TMapKey itself is only kept by HandlesByKey. */
+		uint64 KeyHash = 0;
+	};
+
+	/** Non-const counterpart of ResolveSlot for modifying the listener lists. */
+	FSettingSlot* ResolveMutableSlot(FSettingHandle Handle) { return const_cast<FSettingSlot*>(ResolveSlot(Handle)); }
+
+	/** Returns the slot a handle refers to, or nullptr if the handle is stale. */
+	const FSettingSlot* ResolveSlot(FSettingHandle Handle) const;
+
+	/** Every setting that has been registered through one of the Setup calls, indexed by FSettingHandle. */
+	TArray<FSettingSlot> Slots;
+
+	/** @see FSettingSlotMetadata */
+	TArray<FSettingSlotMetadata> SlotMetadata;
+
+	/** Values of every registered float setting. */
+	FFloatSettingStorage FloatStorage;
+
+	/** Values of every registered opposing toggles setting. */
+	FOpposingTogglesStorage OpposingTogglesStorage;
+
+	/** Values of every registered enum setting. */
+	FEnumSettingStorage EnumStorage;
+
+	/** Option names shared by the opposing toggles and enum storages. */
+	FEasySettingsOptionSetTable OptionSetTable;
+
+	/** Values of every setting registered through SetupSetting, one storage per type. */
+	FGenericSettingStorages GenericStorages;
+
+	/** Values of every registered derived setting. */
+	FDerivedSettingStorage DerivedStorage;
+
+	/** Slots that were released and can be reused by the next registration. */
+	TArray<int32> FreeSlots;
+
+	/** Used by the string key compatibility path to find the handle of a registered setting. */
+	TMap<FString, FSettingHandle> HandlesByKey;
+
+	/** @see GetValueTable */
+	TSharedRef<FEasySettingsValueTable, ESPMode::ThreadSafe> ValueTable = MakeShared<FEasySettingsValueTable, ESPMode::ThreadSafe>();
+
+	/** Set between Initialize and Deinitialize, @see Get. */
+	static UEasySettingsRegistry* Instance;
+};
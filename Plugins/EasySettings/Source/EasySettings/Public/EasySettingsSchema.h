@@ -0,0 +1,149 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasySettingsTraits.h"
+#include "Engine/DataAsset.h"
+#include "SettingTypes/EnumSetting.h"
+#include "SettingTypes/FloatSetting.h"
+#include "SettingTypes/OpposingTogglesSetting.h"
+#include "UObject/ObjectSaveContext.h"
+#include "EasySettingsSchema.generated.h"
+
+/**
+ * A setting of a schema with everything the registry derives from its names worked out at cook time.
+ * Stored in the order the registry registers them, grouped by ini file and section.
+ */
+USTRUCT()
+struct FEasySettingsBakedSetting
+{
+	GENERATED_BODY()
+
+	/** ESettingType of the setting, which also picks the schema array Index points into. */
+	UPROPERTY()
+	uint8 Type = 0;
+
+	/** Index into the schema's array of settings of that type, e.g. FloatSettings. */
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	/** @see FSettingBase::GetTMapKey */
+	UPROPERTY()
+	FString TMapKey;
+
+	/** @see FEasySettingsSnapshot::HashKey */
+	UPROPERTY()
+	uint64 KeyHash = 0;
+
+	/** @see FEasySettingsSnapshot::GetFloatSchemaHash */
+	UPROPERTY()
+	uint32 SchemaHash = 0;
+};
+
+/**
+ * Declares every setting a project uses in one place, so they can be registered together through UEasySettingsRegistry::RegisterSettings
+ * rather than one Setup call at a time from whichever object happens to use them.
+ *
+ * The schema is validated when it is checked by data validation and when it is cooked, where invalid settings fail the cook.
+ * A cooked schema carries its settings' keys, hashes and registration order, so registering it skips validating the Defaults,
+ * building keys and sorting, and only resolves values. Schemas that aren't cooked are registered the same way as before.
+ */
+UCLASS(BlueprintType, DisplayName = "EasySettingsSchema")
+class EASYSETTINGS_API UEasySettingsSchema : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Float settings to register. Current is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FFloatSetting> FloatSettings;
+
+	/** Opposing toggles settings to register. bFirstIsActive is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FOpposingTogglesSetting> OpposingTogglesSettings;
+
+	/** Enum settings to register. Current is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FEnumSetting> EnumSettings;
+
+	/** Int settings to register. Current is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FIntSetting> IntSettings;
+
+	/** Bool settings to register. Current is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FBoolSetting> BoolSettings;
+
+	/** Vector2D settings to register. Current is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FVector2DSetting> Vector2DSettings;
+
+	/** LinearColor settings to register. Current is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FLinearColorSetting> LinearColorSettings;
+
+	/** Key settings to register. Current is ignored, it is resolved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Easy Settings")
+	TArray<FKeySetting> KeySettings;
+
+	/** Returns the array holding the settings of a type listed in EASYSETTINGS_FOR_EACH_GENERIC_SETTING. */
+	template <typename SettingType>
+	const TArray<SettingType>& GetSettings() const
+	{
+		if constexpr (std::is_same_v<SettingType, FIntSetting>)
+		{
+			return IntSettings;
+		}
+		else if constexpr (std::is_same_v<SettingType, FBoolSetting>)
+		{
+			return BoolSettings;
+		}
+		else if constexpr (std::is_same_v<SettingType, FVector2DSetting>)
+		{
+			return Vector2DSettings;
+		}
+		else if constexpr (std::is_same_v<SettingType, FLinearColorSetting>)
+		{
+			return LinearColorSettings;
+		}
+		else
+		{
+			static_assert(std::is_same_v<SettingType, FKeySetting>, "Only the types listed in EASYSETTINGS_FOR_EACH_GENERIC_SETTING have an array in the schema.");
+			return KeySettings;
+		}
+	}
+
+	/** Returns the number of settings of every type. */
+	int32 GetNumSettings() const;
+
+	/**
+	 * Checks every setting the same way the Setup functions do, and for keys used by more than one setting.
+	 * @return	True if nothing was wrong. Otherwise OutErrors holds one line per problem.
+	 */
+	bool Validate(TArray<FText>& OutErrors) const;
+
+	/**
+	 * Order settings are registered in, grouped by ini file and section so each section is only looked up once.
+	 * GConfig section names are case insensitive. Shards compare by name, so the order is the same in the cook and the game.
+	 */
+	static bool RegistrationOrderLess(const FSettingBase& A, const FSettingBase& B);
+
+	/** Returns the settings worked out at cook time, or an empty array if the schema wasn't cooked or didn't validate. */
+	const TArray<FEasySettingsBakedSetting>& GetBakedSettings() const { return BakedSettings; }
+
+	// Begin UObject
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+	// End UObject
+
+private:
+	/** Fills BakedSettings from the settings. Leaves it empty if they don't validate, the errors are logged. */
+	void Bake();
+
+	/** @see GetBakedSettings */
+	UPROPERTY()
+	TArray<FEasySettingsBakedSetting> BakedSettings;
+};
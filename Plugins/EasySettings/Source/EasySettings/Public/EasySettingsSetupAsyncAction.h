@@ -0,0 +1,56 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasySettingsTraits.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SettingTypes/EnumSetting.h"
+#include "SettingTypes/FloatSetting.h"
+#include "SettingTypes/OpposingTogglesSetting.h"
+#include "SettingTypes/SettingHandle.h"
+#include "EasySettingsSetupAsyncAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEasySettingsSetupResolvedSignature, FSettingHandle, Handle);
+
+/**
+ * Latent Blueprint nodes for the asynchronous Setup functions of UEasySettingsRegistry, so BeginPlay doesn't wait on the ini file.
+ * @see UEasySettingsRegistry::SetupFloatSettingAsync
+ */
+UCLASS(DisplayName = "EasySettingsSetupAsyncAction")
+class EASYSETTINGS_API UEasySettingsSetupAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Called on the game thread once the setting is set up. The handle is invalid if the setting could not be registered. */
+	UPROPERTY(BlueprintAssignable)
+	FEasySettingsSetupResolvedSignature Resolved;
+
+	/** Sets up a float setting without reading its ini file on the game thread. */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Float Setting", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UEasySettingsSetupAsyncAction* SetupFloatSettingAsync(UObject* WorldContextObject, FFloatSetting Setting);
+
+	/** Sets up an opposing toggles setting without reading its ini file on the game thread. */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Opposing Toggles Setting", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UEasySettingsSetupAsyncAction* SetupOpposingTogglesSettingAsync(UObject* WorldContextObject, FOpposingTogglesSetting Setting);
+
+	/** Sets up an enum setting without reading its ini file on the game thread. */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Enum Setting", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UEasySettingsSetupAsyncAction* SetupEnumSettingAsync(UObject* WorldContextObject, FEnumSetting Setting);
+
+	// Begin UBlueprintAsyncActionBase
+	virtual void Activate() override;
+	// End UBlueprintAsyncActionBase
+
+private:
+	/** Creates the action, keeping it alive through the world's GameInstance until it resolves. */
+	static UEasySettingsSetupAsyncAction* Create(UObject* WorldContextObject);
+
+	/** Which of the settings below is set up on Activate. */
+	ESettingType Type = ESettingType::None;
+
+	FFloatSetting FloatSetting;
+	FOpposingTogglesSetting OpposingTogglesSetting;
+	FEnumSetting EnumSetting;
+};
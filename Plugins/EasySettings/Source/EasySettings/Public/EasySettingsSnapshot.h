@@ -0,0 +1,132 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Compact binary copy of every registered setting's resolved value, written next to the ini files and memory mapped on the next boot.
+ * Lets the Setup functions resolve values with a binary search instead of parsing them out of GConfig.
+ *
+ * The ini files stay the source of truth. Every ini file that contributed to the snapshot is recorded with a hash of its contents,
+ * and entries are only used while the ini file on disk still hashes the same. Each entry also carries a hash of the setting's
+ * type and valid range, so changing a setting's Min, Max or toggle names in the editor falls back to the ini as well.
+ */
+class EASYSETTINGS_API FEasySettingsSnapshot
+{
+public:
+	/** A single resolved setting, as stored in the snapshot. */
+	struct FEntry
+	{
+		/** @see HashKey */
+		uint64 KeyHash = 0;
+
+		/** Hash of the setting's type and valid range, so a changed schema invalidates the entry. */
+		uint32 SchemaHash = 0;
+
+		/** Raw bits of the resolved value, a float or 0/1 for toggles. */
+		uint32 ValueBits = 0;
+	};
+
+	FEasySettingsSnapshot();
+	~FEasySettingsSnapshot();
+
+	FEasySettingsSnapshot(const FEasySettingsSnapshot&) = delete;
+	FEasySettingsSnapshot& operator=(const FEasySettingsSnapshot&) = delete;
+
+	/** Maps the snapshot file into memory. Returns false if it is missing or malformed, in which case every lookup fails. */
+	bool Load(const FString& Filename);
+
+	/** Unmaps the snapshot. */
+	void Reset();
+
+	/** Returns true if a snapshot is loaded. */
+	bool IsLoaded() const { return NumEntries > 0; }
+
+	/**
+	 * Finds the resolved value of a setting.
+	 * @param KeyHash		HashKey of the setting's FSettingBase::GetTMapKey.
+	 * @param SchemaHash	Must match the hash the entry was written with.
+	 * @param IniFileName	The setting's FSettingBase::GetIniFileName. The entry is ignored if that file changed since the snapshot was written.
+	 * @return				False if there is no usable entry and the value needs to be read from the ini file.
+	 */
+	bool TryFind(uint64 KeyHash, uint32 SchemaHash, const FString& IniFileName, uint32& OutValueBits);
+
+	/** Stops entries from an ini file being used, e.g. once GConfig holds values for it that the snapshot doesn't know about. */
+	void InvalidateIniFile(const FString& IniFileName);
+
+	/**
+	 * Writes a snapshot of the given entries. Call after the ini files have been flushed, as their current contents are hashed into the snapshot.
+	 * @param Filename		Where to write the snapshot.
+	 * @param Entries		Every setting to store. Sorted in place.
+	 * @param IniFileNames	Every ini file the entries were resolved from.
+	 */
+	static bool Write(const FString& Filename, TArray<FEntry>& Entries, const TArray<FString>& IniFileNames);
+
+	/** Returns the snapshot file name, next to the saved ini files. */
+	static FString GetDefaultFilename();
+
+	/** Hash used to look up a setting by its TMapKey. */
+	static uint64 HashKey(const FString& TMapKey);
+
+	/** Entries of float settings are only used if the setting's valid range still matches. */
+	static uint32 GetFloatSchemaHash(float Min, float Max);
+
+	/** Entries of opposing toggles settings are only used if the toggle names still match. FString hashes are case insensitive, same as the toggles. */
+	static uint32 GetOpposingTogglesSchemaHash(const FString& FirstToggle, const FString& SecondToggle);
+
+	/** Entries of enum settings are only used if the options still match, as the stored value is an index into them. */
+	static uint32 GetEnumSchemaHash(const TArray<FString>& Options);
+
+	/** Returns the path of the saved ini file backing a GConfig file name. */
+	static FString GetIniFilePathOnDisk(const FString& IniFileName);
+
+private:
+	struct FHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint32 NumIniFiles = 0;
+		uint32 NumEntries = 0;
+	};
+
+	struct FIniFileRecord
+	{
+		/** Hash of the ini file name, @see HashKey. */
+		uint64 NameHash = 0;
+
+		/** Hash of the ini file's contents on disk when the snapshot was written. */
+		uint64 ContentHash = 0;
+	};
+
+	static constexpr uint32 SnapshotMagic = 0x53534553; // "SESS"
+	static constexpr uint32 SnapshotVersion = 1;
+
+	/** Hashes the saved ini file, or returns 0 if it can't be read. */
+	static uint64 HashIniFileContents(const FString& IniFileName);
+
+	/** Points IniFiles and Entries into the loaded bytes after validating the header. */
+	bool ParseLoadedBytes(const uint8* Data, int64 Size);
+
+	/** Returns true if the ini file hashes the same as when the snapshot was written. Cached per file. */
+	bool IsIniFileFresh(const FString& IniFileName);
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Fallback storage when the platform can't memory map files. */
+	TArray<uint8> LoadedBytes;
+
+	const FIniFileRecord* IniFiles = nullptr;
+	int32 NumIniFiles = 0;
+
+	/** Sorted by KeyHash. */
+	const FEntry* Entries = nullptr;
+	int32 NumEntries = 0;
+
+	/** @see IsIniFileFresh */
+	TMap<FString, bool> IniFileFreshness;
+};
@@ -3,14 +3,24 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "EasySettingsSubsystem.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "SettingTypes/BoolSetting.h"
+#include "SettingTypes/EnumSetting.h"
+#include "SettingTypes/IntSetting.h"
+#include "SettingTypes/KeySetting.h"
+#include "SettingTypes/LinearColorSetting.h"
 #include "SettingTypes/OpposingTogglesSetting.h"
 #include "SettingTypes/FloatSetting.h"
-#include "EasySettingsSubsystem.h"
+#include "SettingTypes/SettingHandle.h"
+#include "SettingTypes/Vector2DSetting.h"
 #include "EasySettingsStatics.generated.h"
 
+class UEasySettingsSchema;
+
 /**
  * Static function library for ease of use between blueprint and C++.
+ * Every function forwards to the module owned UEasySettingsRegistry. Their WorldContextObject is unused, it is only kept so existing Blueprint nodes don't break.
  */
 UCLASS()
 class EASYSETTINGS_API UEasySettingsStatics : public UBlueprintFunctionLibrary
@@ -19,29 +29,36 @@ class EASYSETTINGS_API UEasySettingsStatics : public UBlueprintFunctionLibrary
 	
 public:
 	/**
-	 * Stores a pointer to the setting in a TMap. Updates the setting with what is already present in the ini file or writes the defaults out if it isn't already there.
-	 * Will overwrite existing entries and print a warning to the output if called multiple times on the same entry.
+	 * Updates the setting with what is already present in the ini file or writes the defaults out if it isn't already there, then copies it into the registry's storage.
+	 * Later updates are made to the registry's copy, read them back through the Get functions rather than the struct passed in here.
+	 * If the same entry was already setup, nothing is overwritten: an error is logged and Setting is filled from the registered value.
+	 * If the key belongs to a setting of another type, an error is logged and nothing is setup.
+	 * Use SetupFloatSettingWithHandle to also get the handle the ByHandle and Value functions take.
 	 * @see LogEasySettings category in the output log.
-	 * @param WorldContextObject	World object used for getting the EasySettingsSubsystem.
 	 * @param Setting				The setting we want to setup.
-	 * @param bOutSuccess			True if the setting was set up within Min and Max values. False if the Default value could not be used or another setting was already setup using the provided Setting parameter.
+	 * @param bOutSuccess			True if the setting was set up within Min and Max values. False if the Default value could not be used or a setting of another type was already setup with the same key.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
 	static void SetupFloatSetting(const UObject* WorldContextObject, UPARAM(ref) FFloatSetting& Setting, bool& bOutSuccess);
 
 	/**
-	 * Finds the reference that was stored through the Setup function.
-	 * @param WorldContextObject	World object used for getting the EasySettingsSubsystem.
+	 * Same as SetupFloatSetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupFloatSettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FFloatSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Finds the setting that was stored through the Setup function.
 	 * @param SettingID				The setting we are trying to get.
 	 * @param bOutSuccess			True if the setting was found in our FloatSettings.
-	 * @param OutSetting			A reference to the registered setting.
+	 * @param OutSetting			A copy of the registered setting.
 	 */
 	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
 	static void GetFloatSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool& bOutSuccess, FFloatSetting& OutSetting);
 
 	/**
-	 * Attempts to update the setting reference and store the value in an ini file. Ensures the NewCurrent is within min and max values. Triggers the FloatSettingChanged_Delegate if successful.
-	 * @param WorldContextObject	World object used for getting the EasySettingsSubsystem.
+	 * Attempts to update the registered setting and store the value in an ini file. Ensures the NewCurrent is within min and max values. Triggers the FloatSettingChanged_Delegate if successful.
 	 * @param SettingID				The setting we are trying to update.
 	 * @param NewCurrent			The new current value we are trying to update to.
 	 * @param bOutSuccess			True if the update was successful. False if nothing changed or the setting was never setup.
@@ -50,29 +67,63 @@ public:
 	static void UpdateFloatSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, float NewCurrent, bool& bOutSuccess);
 
 	/**
-	 * Stores a pointer to the setting in a TMap. Updates the setting with what is already present in the ini file or writes the defaults out if it isn't already there.
-	 * Will overwrite existing entries and print a warning to the output if called multiple times on the same entry.
+	 * Finds the setting that was stored through the Setup function without building a string key.
+	 * @param Handle				The handle returned by SetupFloatSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered float setting.
+	 * @param OutSetting			A copy of the registered setting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetFloatSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FFloatSetting& OutSetting);
+
+	/**
+	 * Returns only the Current value of a registered float setting. Cheaper than GetFloatSettingByHandle as nothing is copied besides the float.
+	 * @param Handle				The handle returned by SetupFloatSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered float setting.
+	 * @param OutCurrent			The Current value of the registered setting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetFloatSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, float& OutCurrent);
+
+	/**
+	 * Same as UpdateFloatSetting, but resolves the setting through its handle rather than building a string key.
+	 * @param Handle				The handle returned by SetupFloatSettingWithHandle.
+	 * @param NewCurrent			The new current value we are trying to update to.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateFloatSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, float NewCurrent, bool& bOutSuccess);
+
+	/**
+	 * Updates the setting with what is already present in the ini file or writes the defaults out if it isn't already there, then copies it into the registry's storage.
+	 * Later updates are made to the registry's copy, read them back through the Get functions rather than the struct passed in here.
+	 * If the same entry was already setup, nothing is overwritten: an error is logged and Setting is filled from the registered value.
+	 * If the key belongs to a setting of another type, an error is logged and nothing is setup.
+	 * Use SetupOpposingTogglesSettingWithHandle to also get the handle the ByHandle and Value functions take.
 	 * @see LogEasySettings category in the output log.
-	 * @param WorldContextObject	World object used for getting the EasySettingsSubsystem.
 	 * @param Setting				The setting we want to setup.
-	 * @param bOutSuccess			False if another setting was already setup using the provided Setting parameter.
+	 * @param bOutSuccess			False if a setting of another type was already setup with the same key. A toggle missing from the ini file falls back to its default.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
 	static void SetupOpposingTogglesSetting(const UObject* WorldContextObject, UPARAM(ref) FOpposingTogglesSetting& Setting, bool& bOutSuccess);
 
 	/**
-	 * Finds the reference that was stored through the Setup function.
-	 * @param WorldContextObject	World object used for getting the EasySettingsSubsystem.
+	 * Same as SetupOpposingTogglesSetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupOpposingTogglesSettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FOpposingTogglesSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Finds the setting that was stored through the Setup function.
 	 * @param SettingID				The setting we are trying to get.
 	 * @param bOutSuccess			True if the setting was found in our OpposingTogglesSettings.
-	 * @param OutSetting			A reference to the registered setting.					
+	 * @param OutSetting			A copy of the registered setting.					
 	 */
 	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
 	static void GetOpposingTogglesSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool& bOutSuccess, FOpposingTogglesSetting& OutSetting);
 
 	/**
-	 * Attempts to update the setting reference and store the value in an ini file. Triggers the OpposingTogglesSettingChanged_Delegate if successful.
-	 * @param WorldContextObject	World object used for getting the EasySettingsSubsystem.
+	 * Attempts to update the registered setting and store the value in an ini file. Triggers the OpposingTogglesSettingChanged_Delegate if successful.
 	 * @param SettingID				The setting we are trying to update.
 	 * @param bActivateFirst		What we will set as the updated active toggle.
 	 * @param bOutSuccess			True if the update was successful. False if nothing changed or the setting was never setup.
@@ -80,7 +131,261 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
 	static void UpdateOpposingTogglesSetting(const UObject* WorldContextObject, const FSettingBase& SettingID, bool bActivateFirst, bool& bOutSuccess);
 
-private:
-	/** Helper function for getting the Easy Settings Subsystem. */
-	static UEasySettingsSubsystem& GetESSubsystem(const UObject* WorldContextObject);
+	/**
+	 * Finds the setting that was stored through the Setup function without building a string key.
+	 * @param Handle				The handle returned by SetupOpposingTogglesSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered opposing toggles setting.
+	 * @param OutSetting			A copy of the registered setting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetOpposingTogglesSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FOpposingTogglesSetting& OutSetting);
+
+	/**
+	 * Returns only the active toggle of a registered opposing toggles setting. Cheaper than GetOpposingTogglesSettingByHandle as the toggle names are not copied.
+	 * @param Handle				The handle returned by SetupOpposingTogglesSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered opposing toggles setting.
+	 * @param bOutFirstIsActive		True if the first toggle is currently active.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetOpposingTogglesSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, bool& bOutFirstIsActive);
+
+	/**
+	 * Same as UpdateOpposingTogglesSetting, but resolves the setting through its handle rather than building a string key.
+	 * @param Handle				The handle returned by SetupOpposingTogglesSettingWithHandle.
+	 * @param bActivateFirst		What we will set as the updated active toggle.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateOpposingTogglesSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool bActivateFirst, bool& bOutSuccess);
+
+	/**
+	 * Updates the setting with what is already present in the ini file or writes the defaults out if it isn't already there, then copies it into the registry's storage.
+	 * Later updates are made to the registry's copy, read them back through the Get functions rather than the struct passed in here.
+	 * Use SetupEnumSettingWithHandle to also get the handle the ByHandle and Value functions take.
+	 * @see LogEasySettings category in the output log.
+	 * @param Setting				The setting we want to setup.
+	 * @param bOutSuccess			False if the setting has no Options, or the Default was not one of the Options.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupEnumSetting(const UObject* WorldContextObject, UPARAM(ref) FEnumSetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Same as SetupEnumSetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupEnumSettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FEnumSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Finds the enum setting that was stored through the Setup function.
+	 * @param Handle				The handle returned by SetupEnumSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered enum setting.
+	 * @param OutSetting			A copy of the registered setting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetEnumSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FEnumSetting& OutSetting);
+
+	/**
+	 * Returns only the index of the active option. Cheaper than GetEnumSettingByHandle as the option names are not copied.
+	 * @param Handle				The handle returned by SetupEnumSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered enum setting.
+	 * @param OutCurrent			Index of the active option.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetEnumSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, int32& OutCurrent);
+
+	/**
+	 * Attempts to update the registered setting and store the matching option in an ini file. Triggers the EnumSettingChangedDelegate if successful.
+	 * @param Handle				The handle returned by SetupEnumSettingWithHandle.
+	 * @param NewCurrent			Index of the option we are trying to activate.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed, the index is not one of the Options or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateEnumSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, int32 NewCurrent, bool& bOutSuccess);
+
+	/**
+	 * Updates the setting with what is already present in the ini file or writes the Default out if it isn't there or doesn't pass the setting's validator.
+	 * Use SetupIntSettingWithHandle to also get the handle the ByHandle and Value functions take.
+	 * @param Setting				The setting we want to setup.
+	 * @param bOutSuccess			False if the Default did not pass the setting's validator.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupIntSetting(const UObject* WorldContextObject, UPARAM(ref) FIntSetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Same as SetupIntSetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupIntSettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FIntSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Returns the current value of a registered IntSetting.
+	 * @param Handle				The handle returned by SetupIntSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered IntSetting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetIntSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, int32& OutCurrent);
+
+	/**
+	 * Attempts to update the registered setting and store the value in an ini file. Triggers the SettingChangedDelegate if successful.
+	 * @param Handle				The handle returned by SetupIntSettingWithHandle.
+	 * @param NewCurrent			The new value. Must be within Min and Max and land on a Step.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed, the value is invalid or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateIntSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, int32 NewCurrent, bool& bOutSuccess);
+
+	/**
+	 * Updates the setting with what is already present in the ini file or writes the Default out if it isn't there or doesn't pass the setting's validator.
+	 * Use SetupBoolSettingWithHandle to also get the handle the ByHandle and Value functions take.
+	 * @param Setting				The setting we want to setup.
+	 * @param bOutSuccess			False if the Default did not pass the setting's validator.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupBoolSetting(const UObject* WorldContextObject, UPARAM(ref) FBoolSetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Same as SetupBoolSetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupBoolSettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FBoolSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Returns the current value of a registered BoolSetting.
+	 * @param Handle				The handle returned by SetupBoolSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered BoolSetting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetBoolSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, bool& bOutCurrent);
+
+	/**
+	 * Attempts to update the registered setting and store the value in an ini file. Triggers the SettingChangedDelegate if successful.
+	 * @param Handle				The handle returned by SetupBoolSettingWithHandle.
+	 * @param bNewCurrent			The new value.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed, the value is invalid or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateBoolSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, bool bNewCurrent, bool& bOutSuccess);
+
+	/**
+	 * Updates the setting with what is already present in the ini file or writes the Default out if it isn't there or doesn't pass the setting's validator.
+	 * Use SetupVector2DSettingWithHandle to also get the handle the ByHandle and Value functions take.
+	 * @param Setting				The setting we want to setup.
+	 * @param bOutSuccess			False if the Default did not pass the setting's validator.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupVector2DSetting(const UObject* WorldContextObject, UPARAM(ref) FVector2DSetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Same as SetupVector2DSetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupVector2DSettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FVector2DSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Returns the current value of a registered Vector2DSetting.
+	 * @param Handle				The handle returned by SetupVector2DSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered Vector2DSetting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetVector2DSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FVector2D& OutCurrent);
+
+	/**
+	 * Attempts to update the registered setting and store the value in an ini file. Triggers the SettingChangedDelegate if successful.
+	 * @param Handle				The handle returned by SetupVector2DSettingWithHandle.
+	 * @param NewCurrent			The new value. Both components must be within Min and Max.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed, the value is invalid or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateVector2DSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, const FVector2D& NewCurrent, bool& bOutSuccess);
+
+	/**
+	 * Updates the setting with what is already present in the ini file or writes the Default out if it isn't there or doesn't pass the setting's validator.
+	 * Use SetupLinearColorSettingWithHandle to also get the handle the ByHandle and Value functions take.
+	 * @param Setting				The setting we want to setup.
+	 * @param bOutSuccess			False if the Default did not pass the setting's validator.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupLinearColorSetting(const UObject* WorldContextObject, UPARAM(ref) FLinearColorSetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Same as SetupLinearColorSetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupLinearColorSettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FLinearColorSetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Returns the current value of a registered LinearColorSetting.
+	 * @param Handle				The handle returned by SetupLinearColorSettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered LinearColorSetting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetLinearColorSettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FLinearColor& OutCurrent);
+
+	/**
+	 * Attempts to update the registered setting and store the value in an ini file. Triggers the SettingChangedDelegate if successful.
+	 * @param Handle				The handle returned by SetupLinearColorSettingWithHandle.
+	 * @param NewCurrent			The new color. Components must be between 0 and 1 unless bAllowHDR is set.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed, the value is invalid or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateLinearColorSettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, const FLinearColor& NewCurrent, bool& bOutSuccess);
+
+	/**
+	 * Updates the setting with what is already present in the ini file or writes the Default out if it isn't there or doesn't pass the setting's validator.
+	 * Use SetupKeySettingWithHandle to also get the handle the ByHandle and Value functions take.
+	 * @param Setting				The setting we want to setup.
+	 * @param bOutSuccess			False if the Default did not pass the setting's validator.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupKeySetting(const UObject* WorldContextObject, UPARAM(ref) FKeySetting& Setting, bool& bOutSuccess);
+
+	/**
+	 * Same as SetupKeySetting, but also returns the handle of the registered setting.
+	 * @param OutHandle				Handle for fast lookups of the registered setting. Refers to the existing entry if the setting was already setup, invalid if the key belongs to a setting of another type.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void SetupKeySettingWithHandle(const UObject* WorldContextObject, UPARAM(ref) FKeySetting& Setting, bool& bOutSuccess, FSettingHandle& OutHandle);
+
+	/**
+	 * Returns the current value of a registered KeySetting.
+	 * @param Handle				The handle returned by SetupKeySettingWithHandle.
+	 * @param bOutSuccess			True if the handle refers to a registered KeySetting.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void GetKeySettingValue(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess, FKey& OutCurrent);
+
+	/**
+	 * Attempts to update the registered setting and store the value in an ini file. Triggers the SettingChangedDelegate if successful.
+	 * @param Handle				The handle returned by SetupKeySettingWithHandle.
+	 * @param NewCurrent			The new key. Must be a gamepad key if bGamepad is set, and a keyboard or mouse key otherwise.
+	 * @param bOutSuccess			True if the update was successful. False if nothing changed, the value is invalid or the handle is stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateKeySettingByHandle(const UObject* WorldContextObject, FSettingHandle Handle, const FKey& NewCurrent, bool& bOutSuccess);
+
+	/**
+	 * Registers every setting declared in a schema asset at once. Cheaper than calling the Setup functions one by one,
+	 * as each ini section is read once and each ini file is flushed at most once.
+	 * @param Schema						The settings to register.
+	 * @param OutFloatHandles				Handle for each of the schema's FloatSettings, in the same order.
+	 * @param OutOpposingTogglesHandles		Handle for each of the schema's OpposingTogglesSettings, in the same order.
+	 * @param OutEnumHandles				Handle for each of the schema's EnumSettings, in the same order.
+	 * @param OutGenericHandles				Handle for each of the schema's int, bool, vector, color and key settings, in the same order as their array.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void RegisterSettings(const UObject* WorldContextObject, const UEasySettingsSchema* Schema, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+		FEasySettingsGenericHandles& OutGenericHandles);
+
+	/**
+	 * Unregisters a setting so it can be setup again, e.g. when the object owning the setting is destroyed. Any handles to the setting go stale.
+	 * @param Handle				The handle returned by one of the Setup functions that return one, or by RegisterSettings.
+	 * @param bOutSuccess			False if the handle was already stale.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings Statics", meta = (WorldContext = "WorldContextObject"))
+	static void ReleaseSetting(const UObject* WorldContextObject, FSettingHandle Handle, bool& bOutSuccess);
 };
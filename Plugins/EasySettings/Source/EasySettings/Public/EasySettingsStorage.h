@@ -0,0 +1,296 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasySettingsOptionSets.h"
+#include "EasySettingsTraits.h"
+#include "SettingTypes/EnumSetting.h"
+#include "SettingTypes/FloatSetting.h"
+#include "SettingTypes/OpposingTogglesSetting.h"
+#include "SettingTypes/SettingHandle.h"
+
+/**
+ * Values of every registered float setting, owned by the EasySettingsRegistry.
+ * Stored as parallel arrays so reads and bulk validation only touch the floats they need. Names live in the registry's slot metadata.
+ * Entries are kept dense, releasing a setting swaps the last entry into its place.
+ */
+struct FFloatSettingStorage
+{
+	TArray<float> Current;
+	TArray<float> Min;
+	TArray<float> Max;
+	TArray<float> Default;
+
+	/** Index of the slot in the registry's setting table that owns each entry. */
+	TArray<int32> SlotIndices;
+
+	int32 Num() const { return SlotIndices.Num(); }
+
+	/** Appends an entry and returns its index. */
+	int32 Add(int32 SlotIndex, float InCurrent, float InMin, float InMax, float InDefault)
+	{
+		Current.Add(InCurrent);
+		Min.Add(InMin);
+		Max.Add(InMax);
+		Default.Add(InDefault);
+		return SlotIndices.Add(SlotIndex);
+	}
+
+	/**
+	 * Removes an entry by moving the last entry into its place.
+	 * @return	The slot index owning the entry that moved into Index, or INDEX_NONE if Index was the last entry.
+	 */
+	int32 RemoveAtSwap(int32 Index)
+	{
+		Current.RemoveAtSwap(Index, 1, false);
+		Min.RemoveAtSwap(Index, 1, false);
+		Max.RemoveAtSwap(Index, 1, false);
+		Default.RemoveAtSwap(Index, 1, false);
+		SlotIndices.RemoveAtSwap(Index, 1, false);
+		return SlotIndices.IsValidIndex(Index) ? SlotIndices[Index] : INDEX_NONE;
+	}
+
+	/** Returns true if the value is within the entry's Min and Max values. */
+	bool IsValid(int32 Index, float Value) const { return Value >= Min[Index] && Value <= Max[Index]; }
+
+	/**
+	 * Puts the Previous value back into every entry whose Current value is outside its Min and Max values.
+	 * The loop is branch free over contiguous arrays so the compiler can vectorize it, which matters when a whole ini file is reloaded.
+	 */
+	void RestoreInvalid(TConstArrayView<float> Previous)
+	{
+		check(Previous.Num() == Num());
+
+		float* RESTRICT CurrentData = Current.GetData();
+		const float* RESTRICT MinData = Min.GetData();
+		const float* RESTRICT MaxData = Max.GetData();
+		const float* RESTRICT PreviousData = Previous.GetData();
+
+		const int32 Count = Num();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const float Value = CurrentData[Index];
+			const bool bValid = Value >= MinData[Index] && Value <= MaxData[Index];
+			CurrentData[Index] = bValid ? Value : PreviousData[Index];
+		}
+	}
+};
+
+/**
+ * Values of every registered opposing toggles setting, owned by the EasySettingsRegistry.
+ * The toggle names are only needed when reading or writing the ini, so they are kept apart from the flags.
+ */
+struct FOpposingTogglesStorage
+{
+	TArray<bool> bFirstIsActive;
+	TArray<bool> bFirstIsDefault;
+
+	/** Cold data, the first and second toggle names, interned in the registry's FEasySettingsOptionSetTable. */
+	TArray<const FEasySettingsOptionSet*> Toggles;
+
+	/** Index of the slot in the registry's setting table that owns each entry. */
+	TArray<int32> SlotIndices;
+
+	int32 Num() const { return SlotIndices.Num(); }
+
+	/** Appends an entry and returns its index. */
+	int32 Add(int32 SlotIndex, const FOpposingTogglesSetting& Setting, const FEasySettingsOptionSet& InToggles)
+	{
+		bFirstIsActive.Add(Setting.bFirstIsActive);
+		bFirstIsDefault.Add(Setting.bFirstIsDefault);
+		Toggles.Add(&InToggles);
+		return SlotIndices.Add(SlotIndex);
+	}
+
+	/**
+	 * Removes an entry by moving the last entry into its place.
+	 * @return	The slot index owning the entry that moved into Index, or INDEX_NONE if Index was the last entry.
+	 */
+	int32 RemoveAtSwap(int32 Index)
+	{
+		bFirstIsActive.RemoveAtSwap(Index, 1, false);
+		bFirstIsDefault.RemoveAtSwap(Index, 1, false);
+		Toggles.RemoveAtSwap(Index, 1, false);
+		SlotIndices.RemoveAtSwap(Index, 1, false);
+		return SlotIndices.IsValidIndex(Index) ? SlotIndices[Index] : INDEX_NONE;
+	}
+
+	/**
+	 * Matches an ini value against the entry's toggles, ignoring case without allocating.
+	 * @return	1 for the first toggle, 2 for the second toggle or 0 if nothing matched. Same as FOpposingTogglesSetting::ParseOpposingToggleSetting.
+	 */
+	int32 ParseToggle(int32 Index, const FString& Value) const { return Toggles[Index]->Find(Value) + 1; }
+
+	/** Returns the toggle name as authored. */
+	const FString& GetToggle(int32 Index, bool bFirst) const { return Toggles[Index]->Options[bFirst ? 0 : 1]; }
+
+	/** Returns the lowercase toggle name written to the ini. */
+	const FString& GetToken(int32 Index, bool bFirst) const { return Toggles[Index]->Tokens[bFirst ? 0 : 1]; }
+};
+
+/**
+ * Values of every registered enum setting, owned by the EasySettingsRegistry.
+ * Each entry points at an interned set of its options with a case insensitive lookup table, so parsing an ini value is a single hash lookup without any allocation.
+ */
+struct FEnumSettingStorage
+{
+	TArray<int32> Current;
+	TArray<int32> Default;
+
+	/** Cold data, the option names interned in the registry's FEasySettingsOptionSetTable. Settings with the same options share one set. */
+	TArray<const FEasySettingsOptionSet*> OptionSets;
+
+	/** Index of the slot in the registry's setting table that owns each entry. */
+	TArray<int32> SlotIndices;
+
+	int32 Num() const { return SlotIndices.Num(); }
+
+	/** Appends an entry and returns its index. */
+	int32 Add(int32 SlotIndex, const FEnumSetting& Setting, int32 InDefault, const FEasySettingsOptionSet& InOptions)
+	{
+		Current.Add(Setting.Current);
+		Default.Add(InDefault);
+		OptionSets.Add(&InOptions);
+		return SlotIndices.Add(SlotIndex);
+	}
+
+	/**
+	 * Removes an entry by moving the last entry into its place.
+	 * @return	The slot index owning the entry that moved into Index, or INDEX_NONE if Index was the last entry.
+	 */
+	int32 RemoveAtSwap(int32 Index)
+	{
+		Current.RemoveAtSwap(Index, 1, false);
+		Default.RemoveAtSwap(Index, 1, false);
+		OptionSets.RemoveAtSwap(Index, 1, false);
+		SlotIndices.RemoveAtSwap(Index, 1, false);
+		return SlotIndices.IsValidIndex(Index) ? SlotIndices[Index] : INDEX_NONE;
+	}
+
+	/** Returns true if the value is the index of one of the entry's options. */
+	bool IsValid(int32 Index, int32 Value) const { return OptionSets[Index]->Options.IsValidIndex(Value); }
+
+	/** Returns the index of the option matching an ini value, ignoring case, or INDEX_NONE if nothing matched. */
+	int32 ParseOption(int32 Index, const FString& Value) const { return OptionSets[Index]->Find(Value); }
+
+	/** Returns the lowercase name of an option as written to the ini. */
+	const FString& GetToken(int32 Index, int32 Value) const { return OptionSets[Index]->Tokens[Value]; }
+};
+
+/**
+ * Values of every registered derived setting, owned by the EasySettingsRegistry.
+ * Value caches the result of Function over the inputs and is only recomputed once bDirty was set by a change to one of them.
+ */
+struct FDerivedSettingStorage
+{
+	using FFunction = TFunction<float(TArrayView<const float> Inputs)>;
+
+	TArray<float> Value;
+
+	/** Value the listeners were last notified of, so they only hear about results that actually changed. */
+	TArray<float> Notified;
+
+	TArray<bool> bDirty;
+
+	/** Cold data, the settings each entry is computed from and how. */
+	TArray<TArray<FSettingHandle>> Inputs;
+	TArray<FFunction> Functions;
+
+	/** Index of the slot in the registry's setting table that owns each entry. */
+	TArray<int32> SlotIndices;
+
+	int32 Num() const { return SlotIndices.Num(); }
+
+	/** Appends a dirty entry and returns its index. */
+	int32 Add(int32 SlotIndex, TArrayView<const FSettingHandle> InInputs, FFunction&& InFunction)
+	{
+		Value.Add(0.f);
+		Notified.Add(0.f);
+		bDirty.Add(true);
+		Inputs.Emplace(InInputs.GetData(), InInputs.Num());
+		Functions.Add(MoveTemp(InFunction));
+		return SlotIndices.Add(SlotIndex);
+	}
+
+	/**
+	 * Removes an entry by moving the last entry into its place.
+	 * @return	The slot index owning the entry that moved into Index, or INDEX_NONE if Index was the last entry.
+	 */
+	int32 RemoveAtSwap(int32 Index)
+	{
+		Value.RemoveAtSwap(Index, 1, false);
+		Notified.RemoveAtSwap(Index, 1, false);
+		bDirty.RemoveAtSwap(Index, 1, false);
+		Inputs.RemoveAtSwap(Index, 1, false);
+		Functions.RemoveAtSwap(Index, 1, false);
+		SlotIndices.RemoveAtSwap(Index, 1, false);
+		return SlotIndices.IsValidIndex(Index) ? SlotIndices[Index] : INDEX_NONE;
+	}
+};
+
+/**
+ * Values of every registered setting of a type described by TSettingTraits, owned by the EasySettingsRegistry.
+ * Laid out the same way as the hand written storages above, so each new setting type only needs its traits.
+ */
+template <typename InSettingType>
+struct TSettingStorage
+{
+	using SettingType = InSettingType;
+	using FTraits = TSettingTraits<SettingType>;
+	using ValueType = typename FTraits::ValueType;
+	using FRules = typename FTraits::FRules;
+
+	static constexpr ESettingType Type = FTraits::Type;
+
+	TArray<ValueType> Current;
+	TArray<ValueType> Default;
+	TArray<FRules> Rules;
+
+	/** Index of the slot in the registry's setting table that owns each entry. */
+	TArray<int32> SlotIndices;
+
+	/** Updates staged in the registry's open transaction. */
+	TMap<FSettingHandle, ValueType> Staged;
+
+	/** Persisted values of the settings changed by the registry's preset preview. */
+	TMap<FSettingHandle, ValueType> Previewed;
+
+	/** Values set by the registry's SetPendingValue that differ from the applied value. */
+	TMap<FSettingHandle, ValueType> Pending;
+
+	int32 Num() const { return SlotIndices.Num(); }
+
+	/** Appends an entry and returns its index. */
+	int32 Add(int32 SlotIndex, const ValueType& InCurrent, const ValueType& InDefault, const FRules& InRules)
+	{
+		Current.Add(InCurrent);
+		Default.Add(InDefault);
+		Rules.Add(InRules);
+		return SlotIndices.Add(SlotIndex);
+	}
+
+	/**
+	 * Removes an entry by moving the last entry into its place.
+	 * @return	The slot index owning the entry that moved into Index, or INDEX_NONE if Index was the last entry.
+	 */
+	int32 RemoveAtSwap(int32 Index)
+	{
+		Current.RemoveAtSwap(Index, 1, false);
+		Default.RemoveAtSwap(Index, 1, false);
+		Rules.RemoveAtSwap(Index, 1, false);
+		SlotIndices.RemoveAtSwap(Index, 1, false);
+		return SlotIndices.IsValidIndex(Index) ? SlotIndices[Index] : INDEX_NONE;
+	}
+
+	/** Returns true if the value passes the entry's validator. */
+	bool IsValid(int32 Index, const ValueType& Value) const { return FTraits::IsValid(Rules[Index], Value); }
+};
+
+/** One storage per type in EASYSETTINGS_FOR_EACH_GENERIC_SETTING, in TSettingTraits::StorageIndex order. */
+using FGenericSettingStorages = TTuple<
+	TSettingStorage<FIntSetting>,
+	TSettingStorage<FBoolSetting>,
+	TSettingStorage<FVector2DSetting>,
+	TSettingStorage<FLinearColorSetting>,
+	TSettingStorage<FKeySetting>>;
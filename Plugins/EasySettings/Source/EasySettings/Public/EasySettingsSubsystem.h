@@ -3,13 +3,103 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "SettingTypes/FloatSetting.h"
-#include "SettingTypes/OpposingTogglesSetting.h"
+#include "EasySettingsTraits.h"
+#include "SettingTypes/SettingBase.h"
+#include "SettingTypes/SettingHandle.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "EasySettingsSubsystem.generated.h"
 
+class UEasySettingsPreset;
+class UEasySettingsSchema;
+
+/** Counters describing how often the ini files were written to disk. */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FEasySettingsPersistenceStats
+{
+	GENERATED_BODY()
+
+	/** Number of times an ini file was marked dirty by a setting being written. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 FlushesRequested = 0;
+
+	/** Number of times an ini file was actually flushed to disk. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 FlushesPerformed = 0;
+
+	/** Number of requests that were absorbed by a flush that was already pending for the same ini file. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 FlushesCoalesced = 0;
+
+	/**
+	 * Size on disk of every ini file after it was flushed, added up. GConfig rewrites the whole file on each flush.
+	 * Only measured in builds with stats or tracing, as it costs a file stat per flush. Always 0 otherwise.
+	 */
+	UPROPERTY(BlueprintReadOnly)
+	int64 FlushedFileBytes = 0;
+};
+
+/** Memory taken by the names of every registered setting, compared with what it would take if each setting kept its own copies. */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FEasySettingsMemoryStats
+{
+	GENERATED_BODY()
+
+	/** Number of registered settings. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumSettings = 0;
+
+	/** Number of distinct option lists shared by the enum and opposing toggles settings. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumOptionSets = 0;
+
+	/** Bytes used by the slot metadata, the key lookup table and the interned option names. */
+	UPROPERTY(BlueprintReadOnly)
+	int64 NameBytes = 0;
+
+	/**
+	 * Estimate of the bytes the same names would take with a TMapKey copy in every slot and a copy of its option names in every setting.
+	 * No unshared copies exist to measure, so this adds the sizes those copies would have to NameBytes' measured allocations.
+	 */
+	UPROPERTY(BlueprintReadOnly)
+	int64 NameBytesWithoutSharing = 0;
+};
+
+/** Handles of the settings a schema declares for the types in EASYSETTINGS_FOR_EACH_GENERIC_SETTING, each in the same order as the schema's array. */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FEasySettingsGenericHandles
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FSettingHandle> IntHandles;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FSettingHandle> BoolHandles;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FSettingHandle> Vector2DHandles;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FSettingHandle> LinearColorHandles;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FSettingHandle> KeyHandles;
+
+	/** Returns the handles of the settings of one of the generic types. */
+	template <typename SettingType>
+	TArray<FSettingHandle>& Get()
+	{
+		// In TSettingTraits::StorageIndex order.
+		TArray<FSettingHandle>* Handles[] = { &IntHandles, &BoolHandles, &Vector2DHandles, &LinearColorHandles, &KeyHandles };
+		return *Handles[TSettingTraits<SettingType>::StorageIndex];
+	}
+};
+
 /**
- * Subsystem for storing delegates and TMaps related to our various setting types.
+ * Blueprint access to the EasySettings registry from a GameInstance.
+ * Settings are owned by UEasySettingsRegistry, which the EasySettings module creates on startup. This subsystem keeps no state of its own,
+ * its functions forward to the registry and its delegates relay the registry's, so every GameInstance sees the same settings.
+ * Native code should call UEasySettingsRegistry::Get instead, which doesn't need a world context.
  */
 UCLASS(DisplayName = "EasySettingsSubsystem")
 class EASYSETTINGS_API UEasySettingsSubsystem : public UGameInstanceSubsystem
@@ -24,6 +114,13 @@ public:
 
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFloatSettingChangedSignature, FSettingBase, SettingID, float, NewCurrent);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOpposingTogglesSettingChangedSignature, FSettingBase, SettingID, bool, bNewFirstIsActive);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEnumSettingChangedSignature, FSettingBase, SettingID, int32, NewCurrent);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FSettingChangedSignature, FSettingBase, SettingID, FSettingHandle, Handle);
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSettingsCommittedSignature, const TArray<FSettingHandle>&, ChangedHandles);
+	DECLARE_DYNAMIC_DELEGATE_OneParam(FSettingChangedDynamicSignature, FSettingHandle, Handle);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnSettingChanged, FSettingHandle /*Handle*/);
+	DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(float, FDerivedSettingDynamicFunction, const TArray<float>&, Inputs);
 
 	/** Signals listeners whenever a float setting is updated. */
 	UPROPERTY(BlueprintAssignable, Category = "Easy Settings")
@@ -33,9 +130,267 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Easy Settings")
 	FOpposingTogglesSettingChangedSignature OpposingTogglesSettingChangedDelegate;
 
-	/** Float settings that have been registered through the SetupFloatSetting call. */
-	TMap<FString, FFloatSetting*> FloatSettings;
+	/** Signals listeners whenever an enum setting is updated. */
+	UPROPERTY(BlueprintAssignable, Category = "Easy Settings")
+	FEnumSettingChangedSignature EnumSettingChangedDelegate;
+
+	/**
+	 * Signals listeners whenever a setting going through the generic SetupSetting path is updated, e.g. an int, bool, vector, color or key setting,
+	 * and whenever a derived setting's value changes. The new value can be read through the handle, so one delegate covers every type.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Easy Settings")
+	FSettingChangedSignature SettingChangedDelegate;
+
+	/**
+	 * Signals listeners once per committed transaction with every setting that changed.
+	 * Settings changed through a transaction do not trigger the per type delegates such as FloatSettingChangedDelegate.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Easy Settings")
+	FSettingsCommittedSignature SettingsCommittedDelegate;
+
+	/** @see UEasySettingsRegistry::RegisterSettings */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	void RegisterSettings(const UEasySettingsSchema* Schema, TArray<FSettingHandle>& OutFloatHandles, TArray<FSettingHandle>& OutOpposingTogglesHandles, TArray<FSettingHandle>& OutEnumHandles,
+		FEasySettingsGenericHandles& OutGenericHandles);
+
+	/** @see UEasySettingsRegistry::BindToSettingChanged */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	bool BindToSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event);
+
+	/** @see UEasySettingsRegistry::UnbindFromSettingChanged */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	void UnbindFromSettingChanged(FSettingHandle Handle, FSettingChangedDynamicSignature Event);
+
+	/** @see UEasySettingsRegistry::SetNotifyOnEveryChange */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	bool SetNotifyOnEveryChange(FSettingHandle Handle, bool bEveryChange);
+
+	/** @see UEasySettingsRegistry::FlushPendingNotifications */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	void FlushPendingNotifications();
+
+	/** @see UEasySettingsRegistry::BindPropertyToSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	bool BindPropertyToSetting(FSettingHandle Handle, UObject* Object, FName PropertyName);
+
+	/** @see UEasySettingsRegistry::UnbindObjectFromSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	void UnbindObjectFromSetting(FSettingHandle Handle, UObject* Object);
+
+	/** @see UEasySettingsRegistry::BeginTransaction */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool BeginTransaction();
+
+	/** @see UEasySettingsRegistry::StageFloatSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageFloatSetting(FSettingHandle Handle, float NewCurrent);
+
+	/** @see UEasySettingsRegistry::StageOpposingTogglesSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageOpposingTogglesSetting(FSettingHandle Handle, bool bActivateFirst);
+
+	/** @see UEasySettingsRegistry::StageEnumSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageEnumSetting(FSettingHandle Handle, int32 NewCurrent);
+
+	/** @see UEasySettingsRegistry::StageSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageIntSetting(FSettingHandle Handle, int32 NewCurrent);
+
+	/** @see UEasySettingsRegistry::StageSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageBoolSetting(FSettingHandle Handle, bool bNewCurrent);
+
+	/** @see UEasySettingsRegistry::StageSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageVector2DSetting(FSettingHandle Handle, const FVector2D& NewCurrent);
+
+	/** @see UEasySettingsRegistry::StageSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageLinearColorSetting(FSettingHandle Handle, const FLinearColor& NewCurrent);
+
+	/** @see UEasySettingsRegistry::StageSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool StageKeySetting(FSettingHandle Handle, const FKey& NewCurrent);
+
+	/** @see UEasySettingsRegistry::CommitTransaction */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	bool CommitTransaction(TArray<FSettingHandle>& OutChangedHandles);
+
+	/** @see UEasySettingsRegistry::RollbackTransaction */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Transaction")
+	void RollbackTransaction();
+
+	/** @see UEasySettingsRegistry::IsTransactionOpen */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Transaction")
+	bool IsTransactionOpen() const;
+
+	/** @see UEasySettingsRegistry::ApplyPreset */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Preset")
+	bool ApplyPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles);
+
+	/** @see UEasySettingsRegistry::PreviewPreset */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Preset")
+	bool PreviewPreset(const UEasySettingsPreset* Preset, TArray<FSettingHandle>& OutChangedHandles);
+
+	/** @see UEasySettingsRegistry::RevertPreview */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Preset")
+	void RevertPreview(TArray<FSettingHandle>& OutChangedHandles);
+
+	/** @see UEasySettingsRegistry::IsPreviewingPreset */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Preset")
+	bool IsPreviewingPreset() const;
+
+	/** @see UEasySettingsRegistry::SetPendingFloatValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingFloatValue(FSettingHandle Handle, float NewPending);
+
+	/** @see UEasySettingsRegistry::SetPendingOpposingTogglesValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingOpposingTogglesValue(FSettingHandle Handle, bool bActivateFirst);
+
+	/** @see UEasySettingsRegistry::SetPendingEnumValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingEnumValue(FSettingHandle Handle, int32 NewPending);
+
+	/** @see UEasySettingsRegistry::SetPendingValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingIntValue(FSettingHandle Handle, int32 NewPending);
+
+	/** @see UEasySettingsRegistry::SetPendingValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingBoolValue(FSettingHandle Handle, bool bNewPending);
+
+	/** @see UEasySettingsRegistry::SetPendingValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingVector2DValue(FSettingHandle Handle, const FVector2D& NewPending);
+
+	/** @see UEasySettingsRegistry::SetPendingValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingLinearColorValue(FSettingHandle Handle, const FLinearColor& NewPending);
+
+	/** @see UEasySettingsRegistry::SetPendingValue */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool SetPendingKeyValue(FSettingHandle Handle, const FKey& NewPending);
+
+	/** @see UEasySettingsRegistry::TryGetPendingFloatValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	float GetPendingFloatValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::TryGetPendingOpposingTogglesValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	bool GetPendingOpposingTogglesValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::TryGetPendingEnumValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	int32 GetPendingEnumValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::TryGetPendingValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	int32 GetPendingIntValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::TryGetPendingValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	bool GetPendingBoolValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::TryGetPendingValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	FVector2D GetPendingVector2DValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::TryGetPendingValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	FLinearColor GetPendingLinearColorValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::TryGetPendingValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	FKey GetPendingKeyValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::HasPendingChange */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	bool HasPendingChange(FSettingHandle Handle) const;
+
+	/** @see UEasySettingsRegistry::IsPendingValueDefault */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	bool IsPendingValueDefault(FSettingHandle Handle) const;
+
+	/** @see UEasySettingsRegistry::HasAnyPendingChanges */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	bool HasAnyPendingChanges() const;
+
+	/** @see UEasySettingsRegistry::HasAnyNonDefaultSettings */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Pending")
+	bool HasAnyNonDefaultSettings() const;
+
+	/** @see UEasySettingsRegistry::ApplyAll */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	bool ApplyAll(TArray<FSettingHandle>& OutChangedHandles);
+
+	/** @see UEasySettingsRegistry::RevertAll */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	void RevertAll();
+
+	/** @see UEasySettingsRegistry::ResetAllToDefault */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Pending")
+	void ResetAllToDefault();
+
+	/** @see UEasySettingsRegistry::CreateProfile */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Profile")
+	bool CreateProfile(FName ProfileName, FName ParentProfile);
+
+	/** @see UEasySettingsRegistry::CopyProfile */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Profile")
+	bool CopyProfile(FName SourceProfile, FName NewProfile);
+
+	/** @see UEasySettingsRegistry::DeleteProfile */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Profile")
+	bool DeleteProfile(FName ProfileName);
+
+	/** @see UEasySettingsRegistry::SetActiveProfile */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Profile")
+	bool SetActiveProfile(FName ProfileName, TArray<FSettingHandle>& OutChangedHandles);
+
+	/** @see UEasySettingsRegistry::GetActiveProfile */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Profile")
+	FName GetActiveProfile() const;
+
+	/** @see UEasySettingsRegistry::RegisterDerivedSetting */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings|Derived")
+	FSettingHandle RegisterDerivedSetting(FName Name, const TArray<FSettingHandle>& Inputs, FDerivedSettingDynamicFunction Function);
+
+	/** @see UEasySettingsRegistry::TryGetDerivedValue */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings|Derived")
+	float GetDerivedValue(FSettingHandle Handle, bool& bOutSuccess) const;
+
+	/** @see UEasySettingsRegistry::ReloadFromConfig */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	void ReloadFromConfig(EIniFile IniFile, TArray<FSettingHandle>& OutChangedHandles);
+
+	/** @see UEasySettingsRegistry::FlushDirtyIniFiles */
+	UFUNCTION(BlueprintCallable, Category = "Easy Settings")
+	void FlushDirtyIniFiles();
+
+	/** @see UEasySettingsRegistry::GetPersistenceStats */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings")
+	FEasySettingsPersistenceStats GetPersistenceStats() const;
+
+	/** @see UEasySettingsRegistry::GetMemoryStats */
+	UFUNCTION(BlueprintPure, Category = "Easy Settings")
+	FEasySettingsMemoryStats GetMemoryStats() const;
+
+private:
+	/** Relays the registry's delegates to the ones above. */
+	UFUNCTION()
+	void HandleFloatSettingChanged(FSettingBase SettingID, float NewCurrent);
+
+	UFUNCTION()
+	void HandleOpposingTogglesSettingChanged(FSettingBase SettingID, bool bNewFirstIsActive);
+
+	UFUNCTION()
+	void HandleEnumSettingChanged(FSettingBase SettingID, int32 NewCurrent);
+
+	UFUNCTION()
+	void HandleSettingChanged(FSettingBase SettingID, FSettingHandle Handle);
 
-	/** Opposing Toggles settings that have been registered through the SetupOpposingTogglesSetting call. */
-	TMap<FString, FOpposingTogglesSetting*> OpposingTogglesSettings;
+	UFUNCTION()
+	void HandleSettingsCommitted(const TArray<FSettingHandle>& ChangedHandles);
 };
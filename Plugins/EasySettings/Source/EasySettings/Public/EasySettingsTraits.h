@@ -0,0 +1,245 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingTypes/BoolSetting.h"
+#include "SettingTypes/IntSetting.h"
+#include "SettingTypes/KeySetting.h"
+#include "SettingTypes/LinearColorSetting.h"
+#include "SettingTypes/Vector2DSetting.h"
+
+/** Which setting type a registered slot refers to. */
+enum class ESettingType : uint8
+{
+	None,
+	Float,
+	OpposingToggles,
+	Enum,
+	Int,
+	Bool,
+	Vector2D,
+	LinearColor,
+	Key,
+	/** Computed from other settings rather than stored in an ini file, @see UEasySettingsRegistry::RegisterDerivedSetting. */
+	Derived
+};
+
+/**
+ * Calls Op(SettingType) for every setting type that goes through the generic TSetting code paths rather than its own hand written ones.
+ * Adding a setting type means adding a USTRUCT, a TSettingTraits specialization and an entry here.
+ */
+#define EASYSETTINGS_FOR_EACH_GENERIC_SETTING(Op) \
+	Op(FIntSetting) \
+	Op(FBoolSetting) \
+	Op(FVector2DSetting) \
+	Op(FLinearColorSetting) \
+	Op(FKeySetting)
+
+/**
+ * Compile time description of how a setting type is parsed, validated, compared and stored. Every function is static and inlined,
+ * so the generic registry code compiles down to the same thing as a hand written path for that type, without any virtual dispatch.
+ *
+ * A specialization provides:
+ * - ValueType			The type of Current and Default.
+ * - FRules				Whatever validation needs from the setting besides its value, stored alongside it.
+ * - Type				The matching ESettingType.
+ * - StorageIndex		Position of the type in FGenericSettingStorages.
+ * - bHasValueBits		True if the value fits in 32 bits, which lets it be published to the value table and stored in the snapshot.
+ * - GetRules / ApplyRules, IsValid, MakeValid, Parse, ToString, Equals and GetSchemaHash. ToBits / FromBits when bHasValueBits is set.
+ */
+template <typename SettingType>
+struct TSettingTraits;
+
+template <>
+struct TSettingTraits<FIntSetting>
+{
+	using ValueType = int32;
+
+	struct FRules
+	{
+		int32 Min = 0;
+		int32 Max = 0;
+		int32 Step = 1;
+	};
+
+	static constexpr ESettingType Type = ESettingType::Int;
+	static constexpr int32 StorageIndex = 0;
+	static constexpr bool bHasValueBits = true;
+
+	static FRules GetRules(const FIntSetting& Setting) { return { Setting.Min, Setting.Max, FMath::Max(Setting.Step, 1) }; }
+	static void ApplyRules(const FRules& Rules, FIntSetting& OutSetting) { OutSetting.Min = Rules.Min; OutSetting.Max = Rules.Max; OutSetting.Step = Rules.Step; }
+
+	static bool IsValid(const FRules& Rules, int32 Value) { return Value >= Rules.Min && Value <= Rules.Max && (Value - Rules.Min) % Rules.Step == 0; }
+
+	static int32 MakeValid(const FRules& Rules, int32 Value)
+	{
+		const int32 Clamped = FMath::Clamp(Value, Rules.Min, FMath::Max(Rules.Min, Rules.Max));
+		return Rules.Min + (Clamped - Rules.Min) / Rules.Step * Rules.Step;
+	}
+
+	static bool Parse(const FString& Text, int32& OutValue) { return LexTryParseString(OutValue, *Text); }
+	static FString ToString(int32 Value) { return LexToString(Value); }
+	static bool Equals(int32 A, int32 B) { return A == B; }
+
+	static uint32 ToBits(int32 Value) { return uint32(Value); }
+	static int32 FromBits(uint32 Bits) { return int32(Bits); }
+
+	static uint32 GetSchemaHash(const FRules& Rules)
+	{
+		return HashCombine(HashCombine(HashCombine(::GetTypeHash(uint8(Type)), ::GetTypeHash(Rules.Min)), ::GetTypeHash(Rules.Max)), ::GetTypeHash(Rules.Step));
+	}
+};
+
+template <>
+struct TSettingTraits<FBoolSetting>
+{
+	using ValueType = bool;
+
+	struct FRules
+	{
+	};
+
+	static constexpr ESettingType Type = ESettingType::Bool;
+	static constexpr int32 StorageIndex = 1;
+	static constexpr bool bHasValueBits = true;
+
+	static FRules GetRules(const FBoolSetting& Setting) { return {}; }
+	static void ApplyRules(const FRules& Rules, FBoolSetting& OutSetting) {}
+
+	static bool IsValid(const FRules& Rules, bool bValue) { return true; }
+	static bool MakeValid(const FRules& Rules, bool bValue) { return bValue; }
+
+	/** Only accepts what GConfig writes for bools, so a typo in the ini is reset rather than silently read as false. */
+	static bool Parse(const FString& Text, bool& bOutValue)
+	{
+		if (Text.Equals(TEXT("True"), ESearchCase::IgnoreCase))
+		{
+			bOutValue = true;
+			return true;
+		}
+		else if (Text.Equals(TEXT("False"), ESearchCase::IgnoreCase))
+		{
+			bOutValue = false;
+			return true;
+		}
+
+		return false;
+	}
+
+	static FString ToString(bool bValue) { return bValue ? TEXT("True") : TEXT("False"); }
+	static bool Equals(bool A, bool B) { return A == B; }
+
+	static uint32 ToBits(bool bValue) { return bValue ? 1 : 0; }
+	static bool FromBits(uint32 Bits) { return Bits != 0; }
+
+	static uint32 GetSchemaHash(const FRules& Rules) { return ::GetTypeHash(uint8(Type)); }
+};
+
+template <>
+struct TSettingTraits<FVector2DSetting>
+{
+	using ValueType = FVector2D;
+
+	struct FRules
+	{
+		FVector2D Min = FVector2D::ZeroVector;
+		FVector2D Max = FVector2D::ZeroVector;
+	};
+
+	static constexpr ESettingType Type = ESettingType::Vector2D;
+	static constexpr int32 StorageIndex = 2;
+	static constexpr bool bHasValueBits = false;
+
+	static FRules GetRules(const FVector2DSetting& Setting) { return { Setting.Min, Setting.Max }; }
+	static void ApplyRules(const FRules& Rules, FVector2DSetting& OutSetting) { OutSetting.Min = Rules.Min; OutSetting.Max = Rules.Max; }
+
+	static bool IsValid(const FRules& Rules, const FVector2D& Value)
+	{
+		return Value.X >= Rules.Min.X && Value.X <= Rules.Max.X && Value.Y >= Rules.Min.Y && Value.Y <= Rules.Max.Y;
+	}
+
+	static FVector2D MakeValid(const FRules& Rules, const FVector2D& Value)
+	{
+		return FVector2D(FMath::Clamp(Value.X, Rules.Min.X, Rules.Max.X), FMath::Clamp(Value.Y, Rules.Min.Y, Rules.Max.Y));
+	}
+
+	static bool Parse(const FString& Text, FVector2D& OutValue) { return OutValue.InitFromString(Text); }
+	static FString ToString(const FVector2D& Value) { return Value.ToString(); }
+	static bool Equals(const FVector2D& A, const FVector2D& B) { return A == B; }
+
+	static uint32 GetSchemaHash(const FRules& Rules) { return HashCombine(HashCombine(::GetTypeHash(uint8(Type)), GetTypeHash(Rules.Min)), GetTypeHash(Rules.Max)); }
+};
+
+template <>
+struct TSettingTraits<FLinearColorSetting>
+{
+	using ValueType = FLinearColor;
+
+	struct FRules
+	{
+		bool bAllowHDR = false;
+	};
+
+	static constexpr ESettingType Type = ESettingType::LinearColor;
+	static constexpr int32 StorageIndex = 3;
+	static constexpr bool bHasValueBits = false;
+
+	static FRules GetRules(const FLinearColorSetting& Setting) { return { Setting.bAllowHDR }; }
+	static void ApplyRules(const FRules& Rules, FLinearColorSetting& OutSetting) { OutSetting.bAllowHDR = Rules.bAllowHDR; }
+
+	static bool IsValid(const FRules& Rules, const FLinearColor& Value)
+	{
+		const float MaxComponent = Rules.bAllowHDR ? TNumericLimits<float>::Max() : 1.f;
+		return Value.R >= 0.f && Value.R <= MaxComponent
+			&& Value.G >= 0.f && Value.G <= MaxComponent
+			&& Value.B >= 0.f && Value.B <= MaxComponent
+			&& Value.A >= 0.f && Value.A <= 1.f;
+	}
+
+	static FLinearColor MakeValid(const FRules& Rules, const FLinearColor& Value)
+	{
+		const float MaxComponent = Rules.bAllowHDR ? TNumericLimits<float>::Max() : 1.f;
+		return FLinearColor(FMath::Clamp(Value.R, 0.f, MaxComponent), FMath::Clamp(Value.G, 0.f, MaxComponent), FMath::Clamp(Value.B, 0.f, MaxComponent), FMath::Clamp(Value.A, 0.f, 1.f));
+	}
+
+	static bool Parse(const FString& Text, FLinearColor& OutValue) { return OutValue.InitFromString(Text); }
+	static FString ToString(const FLinearColor& Value) { return Value.ToString(); }
+	static bool Equals(const FLinearColor& A, const FLinearColor& B) { return A == B; }
+
+	static uint32 GetSchemaHash(const FRules& Rules) { return HashCombine(::GetTypeHash(uint8(Type)), ::GetTypeHash(Rules.bAllowHDR)); }
+};
+
+template <>
+struct TSettingTraits<FKeySetting>
+{
+	using ValueType = FKey;
+
+	struct FRules
+	{
+		bool bGamepad = false;
+	};
+
+	static constexpr ESettingType Type = ESettingType::Key;
+	static constexpr int32 StorageIndex = 4;
+	static constexpr bool bHasValueBits = false;
+
+	static FRules GetRules(const FKeySetting& Setting) { return { Setting.bGamepad }; }
+	static void ApplyRules(const FRules& Rules, FKeySetting& OutSetting) { OutSetting.bGamepad = Rules.bGamepad; }
+
+	static bool IsValid(const FRules& Rules, const FKey& Value) { return Value.IsValid() && Value.IsGamepadKey() == Rules.bGamepad; }
+
+	/** There is no sensible key to fall back to, an invalid Default stays invalid and is logged by the registry. */
+	static FKey MakeValid(const FRules& Rules, const FKey& Value) { return Value; }
+
+	static bool Parse(const FString& Text, FKey& OutValue)
+	{
+		OutValue = FKey(*Text);
+		return OutValue.IsValid();
+	}
+
+	static FString ToString(const FKey& Value) { return Value.GetFName().ToString(); }
+	static bool Equals(const FKey& A, const FKey& B) { return A == B; }
+
+	static uint32 GetSchemaHash(const FRules& Rules) { return HashCombine(::GetTypeHash(uint8(Type)), ::GetTypeHash(Rules.bGamepad)); }
+};
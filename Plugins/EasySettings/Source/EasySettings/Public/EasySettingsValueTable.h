@@ -0,0 +1,90 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingTypes/SettingHandle.h"
+#include <atomic>
+
+/**
+ * Thread safe mirror of the current value of every registered setting, for reading settings from worker, render or physics threads.
+ * Only the game thread writes to the table, whenever a setting is registered, updated or released. Any thread can read from it without taking a lock.
+ *
+ * Each value is stored alongside the generation of the handle that owns it in a single 64 bit atomic, so a read either sees a complete value for the
+ * requested handle or fails. Storage is split into fixed size pages that are never moved or freed while the table is alive, so readers never race
+ * with the table growing. Hold on to the table through the shared reference returned by UEasySettingsRegistry::GetValueTable, it outlives the registry.
+ */
+class EASYSETTINGS_API FEasySettingsValueTable
+{
+public:
+	FEasySettingsValueTable();
+	~FEasySettingsValueTable();
+
+	FEasySettingsValueTable(const FEasySettingsValueTable&) = delete;
+	FEasySettingsValueTable& operator=(const FEasySettingsValueTable&) = delete;
+
+	/** Number of values stored per page. */
+	static constexpr int32 PageSize = 256;
+
+	/** Maximum number of pages, which caps the table at PageSize * MaxPages settings. */
+	static constexpr int32 MaxPages = 256;
+
+	/** Game thread only. Publishes the current value of a float setting. */
+	void PublishFloat(FSettingHandle Handle, float Value);
+
+	/** Game thread only. Publishes the current value of a boolean setting, such as which of two opposing toggles is active. */
+	void PublishBool(FSettingHandle Handle, bool bValue);
+
+	/** Game thread only. Publishes the current value of an integer setting, such as the active option of an enum setting. */
+	void PublishInt(FSettingHandle Handle, int32 Value);
+
+	/** Game thread only. Clears the value of a released setting so stale handles stop resolving. */
+	void Retire(FSettingHandle Handle);
+
+	/** Any thread. Returns false if the handle is stale or was never published. */
+	bool TryReadFloat(FSettingHandle Handle, float& OutValue) const;
+
+	/** Any thread. Returns false if the handle is stale or was never published. */
+	bool TryReadBool(FSettingHandle Handle, bool& bOutValue) const;
+
+	/** Any thread. Returns false if the handle is stale or was never published. */
+	bool TryReadInt(FSettingHandle Handle, int32& OutValue) const;
+
+	/** Any thread. Returns Fallback if the handle is stale or was never published. */
+	float ReadFloat(FSettingHandle Handle, float Fallback = 0.f) const
+	{
+		float Value;
+		return TryReadFloat(Handle, Value) ? Value : Fallback;
+	}
+
+	/** Any thread. Returns bFallback if the handle is stale or was never published. */
+	bool ReadBool(FSettingHandle Handle, bool bFallback = false) const
+	{
+		bool bValue;
+		return TryReadBool(Handle, bValue) ? bValue : bFallback;
+	}
+
+	/** Any thread. Returns Fallback if the handle is stale or was never published. */
+	int32 ReadInt(FSettingHandle Handle, int32 Fallback = 0) const
+	{
+		int32 Value;
+		return TryReadInt(Handle, Value) ? Value : Fallback;
+	}
+
+private:
+	struct FPage
+	{
+		/** Upper 32 bits hold the owning handle's generation plus one, so zero means empty. Lower 32 bits hold the value. */
+		std::atomic<uint64> Entries[PageSize];
+	};
+
+	/** Writes an entry, allocating its page on first use. */
+	void Publish(FSettingHandle Handle, uint32 ValueBits);
+
+	/** Reads an entry and checks it belongs to Handle. */
+	bool TryRead(FSettingHandle Handle, uint32& OutValueBits) const;
+
+	static uint64 PackEntry(int32 Generation, uint32 ValueBits) { return (uint64(uint32(Generation) + 1) << 32) | ValueBits; }
+
+	std::atomic<FPage*> Pages[MaxPages];
+};
@@ -0,0 +1,25 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingBase.h"
+#include "BoolSetting.generated.h"
+
+/**
+ * Setting used for a simple on/off value, stored as True or False in the ini file.
+ * Use an OpposingTogglesSetting instead when the two states need their own names.
+ */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FBoolSetting : public FSettingBase
+{
+	GENERATED_BODY()
+
+	/** Stored and retrieved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	bool Current = false;
+
+	/** The ini file will be populated with this, should it be missing or unreadable. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	bool Default = false;
+};
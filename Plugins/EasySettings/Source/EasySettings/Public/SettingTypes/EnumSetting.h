@@ -0,0 +1,62 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingBase.h"
+#include "EnumSetting.generated.h"
+
+/**
+ * Setting used to choose one of several named options, such as quality tiers or window modes.
+ * The ini file stores the lowercase name of the active option.
+ */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FEnumSetting : public FSettingBase
+{
+	GENERATED_BODY()
+
+	/** Disabled default constructor. */
+	FEnumSetting() {}
+
+	FEnumSetting(EIniFile ConfigFile, FString ConfigSection, FString ValueKey, TArray<FString> OptionNames, int32 DefaultAndCurrentIndex = 0)
+	{
+		IniFile = ConfigFile;
+		Section = ConfigSection;
+		Key = ValueKey;
+
+		Options = MoveTemp(OptionNames);
+		Current = DefaultAndCurrentIndex;
+		Default = DefaultAndCurrentIndex;
+	}
+
+	/** Returns true if CheckThis is the index of one of the Options. */
+	bool ValidateEnumSetting(int32 CheckThis) const
+	{
+		return Options.IsValidIndex(CheckThis);
+	}
+
+	/**
+	 * Finds the option matching the provided string, ignoring case.
+	 * Registered settings are parsed through a lookup table in the EasySettingsRegistry instead, this walks the Options.
+	 * @return	The index of the matching option, or INDEX_NONE if nothing matched.
+	 */
+	int32 ParseEnumSetting(const FString& CheckThis) const
+	{
+		return Options.IndexOfByPredicate([&CheckThis](const FString& Option) { return Option.Equals(CheckThis, ESearchCase::IgnoreCase); });
+	}
+
+	/** The names of every option. Matched without case, so no two options should differ only by case. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	TArray<FString> Options;
+
+	/** Index of the active option. Stored and retrieved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	int32 Current = 0;
+
+	/**
+	 * The Current value will default to this if the ini holds something that isn't one of the Options.
+	 * The ini file will be populated with this, should it be missing.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	int32 Default = 0;
+};
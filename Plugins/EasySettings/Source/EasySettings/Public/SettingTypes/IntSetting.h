@@ -0,0 +1,40 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingBase.h"
+#include "IntSetting.generated.h"
+
+/**
+ * Setting used to ensure whole numbers stay within a specific range, optionally snapped to a step.
+ * @see TSettingTraits<FIntSetting> for how it is parsed and validated.
+ */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FIntSetting : public FSettingBase
+{
+	GENERATED_BODY()
+
+	/** The minimum value this setting can be set to. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	int32 Min = 0;
+
+	/** The maximum value this setting can be set to. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	int32 Max = 100;
+
+	/** Valid values are Min plus a multiple of Step. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ClampMin = "1"))
+	int32 Step = 1;
+
+	/** Stored and retrieved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	int32 Current = 50;
+
+	/**
+	 * The Current value will default to this if it isn't valid.
+	 * The ini file will be populated with this, should it be missing.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	int32 Default = 50;
+};
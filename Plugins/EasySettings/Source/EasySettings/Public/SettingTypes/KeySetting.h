@@ -0,0 +1,32 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "SettingBase.h"
+#include "KeySetting.generated.h"
+
+/**
+ * Setting used for a single key binding, stored by key name in the ini file.
+ */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FKeySetting : public FSettingBase
+{
+	GENERATED_BODY()
+
+	/** True if this binding is for a gamepad, in which case only gamepad keys are valid. Otherwise only keyboard and mouse keys are. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	bool bGamepad = false;
+
+	/** Stored and retrieved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FKey Current;
+
+	/**
+	 * The Current value will default to this if it isn't valid.
+	 * The ini file will be populated with this, should it be missing.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	FKey Default;
+};
@@ -0,0 +1,31 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingBase.h"
+#include "LinearColorSetting.generated.h"
+
+/**
+ * Setting used for colors, such as crosshair or colorblind palettes. Components are kept within 0 and 1 unless bAllowHDR is set.
+ */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FLinearColorSetting : public FSettingBase
+{
+	GENERATED_BODY()
+
+	/** Allows the color components to go above 1. Alpha is always kept within 0 and 1. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	bool bAllowHDR = false;
+
+	/** Stored and retrieved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FLinearColor Current = FLinearColor::White;
+
+	/**
+	 * The Current value will default to this if it isn't valid.
+	 * The ini file will be populated with this, should it be missing.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	FLinearColor Default = FLinearColor::White;
+};
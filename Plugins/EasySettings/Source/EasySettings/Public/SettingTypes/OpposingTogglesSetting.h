@@ -47,19 +47,19 @@ struct FOpposingTogglesSetting : public FSettingBase
 	}
 
 	/**
-	 * Ensures that the provided string matches either the first or second toggle.
+	 * Ensures that the provided string matches either the first or second toggle. Ignores case without allocating lowercase copies.
 	 * @param CheckThis		The string we'll be checking against the first and second toggles.
 	 * @return				0 if nothing matched.
 	 * @return				1 if the FirstToggle matches the CheckThis value.
 	 * @return				2 if the SecondToggle matches the CheckThis value.
 	 */
-	int ParseOpposingToggleSetting(FString CheckThis)
+	int ParseOpposingToggleSetting(const FString& CheckThis) const
 	{
-		if (FirstToggle.ToLower() == CheckThis.ToLower())
+		if (FirstToggle.Equals(CheckThis, ESearchCase::IgnoreCase))
 		{
 			return 1;
 		}
-		else if (SecondToggle.ToLower() == CheckThis.ToLower())
+		else if (SecondToggle.Equals(CheckThis, ESearchCase::IgnoreCase))
 		{
 			return 2;
 		}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "EasySettingsIniShards.h"
 #include "SettingBase.generated.h"
 
 /**
@@ -13,6 +14,7 @@
  * GameUserSettings.ini
  * Input.ini
  * Engine.ini
+ * EasySettings_<Shard>.ini, @see FEasySettingsIniShards
  */
 UENUM(BlueprintType, Category = "Easy Settings")
 enum EIniFile
@@ -20,7 +22,8 @@ enum EIniFile
 	Game,
 	GameUserSettings,
 	Input,
-	Engine
+	Engine,
+	Sharded
 };
 
 /**
@@ -47,6 +50,8 @@ struct FSettingBase
 			return GInputIni;
 		case Engine:
 			return GEngineIni;
+		case Sharded:
+			return FEasySettingsIniShards::GetIniFileName(Shard);
 		}
 
 		return FString("No match found!");
@@ -65,21 +70,38 @@ struct FSettingBase
 			return GInputIni;
 		case Engine:
 			return GEngineIni;
+		case Sharded:
+			return FEasySettingsIniShards::GetIniFileName(Shard);
 		}
 
 		return FString("No match found!");
 	}
 
 	/** Returns a key used for our TMaps. */
-	FString GetTMapKey() { return *UEnum::GetValueAsString(IniFile) + Section + Key; }
+	FString GetTMapKey() { return static_cast<const FSettingBase*>(this)->GetTMapKey(); }
 
 	/** Returns a key used for our TMaps. */
-	FString GetTMapKey() const { return *UEnum::GetValueAsString(IniFile) + Section + Key; }
+	FString GetTMapKey() const
+	{
+		// Shards are only part of the key for sharded settings, so keys of existing settings don't change.
+		return IniFile == Sharded ? *UEnum::GetValueAsString(IniFile) + Shard.ToString() + Section + Key : *UEnum::GetValueAsString(IniFile) + Section + Key;
+	}
 	
 	/** The ini file we want to populate with this setting. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	TEnumAsByte<EIniFile> IniFile = Game;
 
+	/** The ini file shard this setting is stored in when IniFile is Sharded. Settings sharing a shard are flushed together, so group them by how often they change. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta = (EditCondition = "IniFile == EIniFile::Sharded"))
+	FName Shard = NAME_None;
+
+	/**
+	 * Where a Sharded setting used to be stored. The first time the setting is missing from its shard, its value is copied over from here.
+	 * The old value is left in place, so going back to the old ini file doesn't lose it. Set to Sharded to skip the migration.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta = (EditCondition = "IniFile == EIniFile::Sharded"))
+	TEnumAsByte<EIniFile> MigrateFrom = Game;
+
 	/** The section in the ini file that this setting will be stored. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	FString Section = "";
@@ -0,0 +1,51 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingHandle.generated.h"
+
+/**
+ * Lightweight reference to a setting that has been registered with the EasySettingsRegistry.
+ * Returned by the Setup functions, a handle resolves to the registered setting with a single array index rather than building and hashing a string key.
+ *
+ * A handle goes stale once the setting it refers to is released. Stale handles fail to resolve rather than pointing at whichever setting reused the slot.
+ */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FSettingHandle
+{
+	GENERATED_BODY()
+
+	FSettingHandle() {}
+
+	FSettingHandle(int32 InIndex, int32 InGeneration)
+		: Index(InIndex)
+		, Generation(InGeneration)
+	{
+	}
+
+	/** Returns true if this handle was ever assigned to a setting. This does not guarantee the setting is still registered. */
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	/** Clears the handle so it no longer refers to any setting. */
+	void Invalidate() { *this = FSettingHandle(); }
+
+	int32 GetIndex() const { return Index; }
+
+	int32 GetGeneration() const { return Generation; }
+
+	bool operator==(const FSettingHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+
+	bool operator!=(const FSettingHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FSettingHandle& Handle) { return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation)); }
+
+private:
+	/** Slot in the registry's setting table. */
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	/** Incremented every time the slot is reused, so old handles to the same slot can be told apart. */
+	UPROPERTY()
+	int32 Generation = 0;
+};
@@ -0,0 +1,35 @@
+// Copyright Nathan Ralph. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SettingBase.h"
+#include "Vector2DSetting.generated.h"
+
+/**
+ * Setting used to ensure both components of a 2D vector stay within a specific range, e.g. a resolution or a per axis sensitivity.
+ */
+USTRUCT(BlueprintType, Category = "Easy Settings")
+struct FVector2DSetting : public FSettingBase
+{
+	GENERATED_BODY()
+
+	/** The minimum value of each component. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	FVector2D Min = FVector2D::ZeroVector;
+
+	/** The maximum value of each component. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	FVector2D Max = FVector2D::UnitVector;
+
+	/** Stored and retrieved from the ini file. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FVector2D Current = FVector2D::ZeroVector;
+
+	/**
+	 * The Current value will default to this if either component is outside the Min or Max values.
+	 * The ini file will be populated with this, should it be missing.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	FVector2D Default = FVector2D::ZeroVector;
+};